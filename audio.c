@@ -0,0 +1,253 @@
+/**
+ * @file audio.c
+ * @brief Two-voice wavetable mixer streamed to the buzzer PWM by DMA.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "audio.h"
+
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+#include "tone_sequencer.h"
+
+#define AUDIO_RING_SAMPLES (2 * AUDIO_BLOCK_SAMPLES)
+#define AUDIO_RING_BITS 10   // log2 do anel em bytes (512 amostras de 16 bits)
+#define AUDIO_MIDPOINT 128   // Nível de repouso com a PWM de 8 bits
+#define AUDIO_PWM_WRAP 255
+
+typedef struct
+{
+  uint32_t phase;     // Posição na tabela (8 bits altos = índice)
+  uint32_t step;      // Incremento de fase por amostra
+  uint32_t remaining; // Amostras até o release (0 = sustenta)
+  int32_t gain;       // 0 até volume * AUDIO_RAMP_SAMPLES
+  uint8_t volume;
+  bool active;
+  bool releasing;
+} Voice;
+
+// Um ciclo de onda quadrada suavizada (fundamental + 3ª e 5ª harmônicas),
+// na SRAM porque é lida a cada amostra dentro da interrupção
+static const int8_t __not_in_flash("audio") wavetable[256] = {
+    0, 10, 20, 30, 39, 49, 58, 66, 74, 82, 89, 96, 102, 107, 112, 116,
+    119, 122, 124, 126, 127, 127, 127, 126, 125, 124, 122, 121, 118, 116, 114, 111,
+    109, 107, 105, 102, 101, 99, 97, 96, 95, 95, 94, 94, 95, 95, 96, 97,
+    98, 99, 101, 102, 104, 106, 108, 109, 111, 112, 114, 115, 116, 117, 117, 118,
+    118, 118, 117, 117, 116, 115, 114, 112, 111, 109, 108, 106, 104, 102, 101, 99,
+    98, 97, 96, 95, 95, 94, 94, 95, 95, 96, 97, 99, 101, 102, 105, 107,
+    109, 111, 114, 116, 118, 121, 122, 124, 125, 126, 127, 127, 127, 126, 124, 122,
+    119, 116, 112, 107, 102, 96, 89, 82, 74, 66, 58, 49, 39, 30, 20, 10,
+    0, -10, -20, -30, -39, -49, -58, -66, -74, -82, -89, -96, -102, -107, -112, -116,
+    -119, -122, -124, -126, -127, -127, -127, -126, -125, -124, -122, -121, -118, -116, -114, -111,
+    -109, -107, -105, -102, -101, -99, -97, -96, -95, -95, -94, -94, -95, -95, -96, -97,
+    -98, -99, -101, -102, -104, -106, -108, -109, -111, -112, -114, -115, -116, -117, -117, -118,
+    -118, -118, -117, -117, -116, -115, -114, -112, -111, -109, -108, -106, -104, -102, -101, -99,
+    -98, -97, -96, -95, -95, -94, -94, -95, -95, -96, -97, -99, -101, -102, -105, -107,
+    -109, -111, -114, -116, -118, -121, -122, -124, -125, -126, -127, -127, -127, -126, -124, -122,
+    -119, -116, -112, -107, -102, -96, -89, -82, -74, -66, -58, -49, -39, -30, -20, -10,
+};
+
+// Anel de dois blocos lido pelo DMA; o alinhamento permite o wrap do endereço
+static uint16_t ring[AUDIO_RING_SAMPLES] __attribute__((aligned(AUDIO_RING_SAMPLES * sizeof(uint16_t))));
+static bool blockHasMore[2]; // O bloco não termina em silêncio
+static uint8_t playingBlock = 0;
+static bool lastBlockQueued = false;
+static volatile bool streaming = false;
+
+static Voice voices[AUDIO_VOICE_COUNT];
+static int32_t bias = 0; // Sobe até AUDIO_MIDPOINT ao começar e volta a 0 no fim (sem estalo)
+
+static int dmaChannel = -1;
+static uint sliceNum;
+
+/**
+ * @brief Mixes the voices into one block of PWM levels.
+ * @return Whether anything still sounds after the block
+ */
+static bool __not_in_flash_func(mixBlock)(uint16_t *out)
+{
+  bool anyActive = false;
+  for (int n = 0; n < AUDIO_VOICE_COUNT; n++)
+    anyActive |= voices[n].active;
+  int32_t biasTarget = anyActive ? AUDIO_MIDPOINT : 0;
+
+  for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+  {
+    int32_t acc = 0;
+    for (int n = 0; n < AUDIO_VOICE_COUNT; n++)
+    {
+      Voice *v = &voices[n];
+      if (!v->active)
+        continue;
+
+      if (v->remaining && --v->remaining == 0)
+        v->releasing = true;
+      if (v->releasing)
+      {
+        v->gain -= v->volume;
+        if (v->gain <= 0)
+        {
+          v->gain = 0;
+          v->active = false;
+          continue;
+        }
+      }
+      else if (v->gain < v->volume * AUDIO_RAMP_SAMPLES)
+      {
+        v->gain += v->volume;
+      }
+
+      acc += wavetable[v->phase >> 24] * v->gain;
+      v->phase += v->step;
+    }
+
+    if (bias < biasTarget)
+      bias++;
+    else if (bias > biasTarget)
+      bias--;
+
+    int32_t level = bias + acc / (256 * AUDIO_RAMP_SAMPLES);
+    out[i] = (uint16_t)(level < 0 ? 0 : (level > AUDIO_PWM_WRAP ? AUDIO_PWM_WRAP : level));
+  }
+
+  bool more = bias > 0;
+  for (int n = 0; n < AUDIO_VOICE_COUNT; n++)
+    more |= voices[n].active;
+  return more;
+}
+
+static void __not_in_flash_func(audioDmaIrqHandler)(void)
+{
+  if (!dma_channel_get_irq0_status(dmaChannel))
+    return;
+  dma_channel_acknowledge_irq0(dmaChannel);
+
+  if (lastBlockQueued)
+  {
+    // O bloco final (que termina em 0) acabou de tocar
+    lastBlockQueued = false;
+    streaming = false;
+    return;
+  }
+
+  // O anel continua no outro bloco, já misturado; o que acabou de tocar é refeito
+  uint8_t finished = playingBlock;
+  playingBlock ^= 1;
+  dma_channel_set_trans_count(dmaChannel, AUDIO_BLOCK_SAMPLES, true);
+
+  lastBlockQueued = !blockHasMore[playingBlock];
+  if (!lastBlockQueued)
+    blockHasMore[finished] = mixBlock(&ring[finished * AUDIO_BLOCK_SAMPLES]);
+}
+
+/**
+ * @brief Makes sure the ring is playing. Called with interrupts disabled.
+ */
+static void startStreaming(void)
+{
+  if (streaming)
+  {
+    // O próximo bloco já foi misturado em silêncio (e o IRQ vai marcá-lo como o último)
+    // ou já é o último: refaz com a voz nova e segue tocando
+    uint8_t next = playingBlock ^ 1;
+    if (lastBlockQueued || !blockHasMore[next])
+    {
+      blockHasMore[next] = mixBlock(&ring[next * AUDIO_BLOCK_SAMPLES]);
+      lastBlockQueued = false;
+    }
+    return;
+  }
+
+  playingBlock = 0;
+  blockHasMore[0] = mixBlock(&ring[0]);
+  blockHasMore[1] = blockHasMore[0] && mixBlock(&ring[AUDIO_BLOCK_SAMPLES]);
+  lastBlockQueued = !blockHasMore[0];
+
+  streaming = true;
+  dma_channel_set_read_addr(dmaChannel, ring, false);
+  dma_channel_set_trans_count(dmaChannel, AUDIO_BLOCK_SAMPLES, true);
+}
+
+void initAudio(void)
+{
+  // PWM de 8 bits no clock do sistema: portadora de ~488 kHz a 125 MHz, acima do audível
+  gpio_set_function(BUZZER_PIN, GPIO_FUNC_PWM);
+  sliceNum = pwm_gpio_to_slice_num(BUZZER_PIN);
+  pwm_config pwmCfg = pwm_get_default_config();
+  pwm_config_set_wrap(&pwmCfg, AUDIO_PWM_WRAP);
+  pwm_init(sliceNum, &pwmCfg, true);
+  pwm_set_gpio_level(BUZZER_PIN, 0);
+
+  // O timer de DMA dita a taxa de amostragem: uma transferência a cada clk_sys / taxa
+  int timer = dma_claim_unused_timer(true);
+  dma_timer_set_fraction((uint)timer, 1, (uint16_t)(clock_get_hz(clk_sys) / AUDIO_SAMPLE_RATE));
+
+  // Escritas de 16 bits num registrador do APB são replicadas nas duas metades:
+  // o mesmo nível vai para os canais A e B do slice, e o do buzzer é um deles
+  dmaChannel = dma_claim_unused_channel(true);
+  dma_channel_config cfg = dma_channel_get_default_config(dmaChannel);
+  channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+  channel_config_set_read_increment(&cfg, true);
+  channel_config_set_write_increment(&cfg, false);
+  channel_config_set_ring(&cfg, false, AUDIO_RING_BITS);
+  channel_config_set_dreq(&cfg, dma_get_timer_dreq((uint)timer));
+  dma_channel_configure(dmaChannel, &cfg, &pwm_hw->slice[sliceNum].cc, ring, AUDIO_BLOCK_SAMPLES, false);
+
+  dma_channel_set_irq0_enabled(dmaChannel, true);
+  irq_add_shared_handler(DMA_IRQ_0, audioDmaIrqHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_0, true);
+}
+
+void audioTone(AudioVoice voice, uint16_t frequency, uint16_t durationMs, uint8_t volume)
+{
+  if (voice >= AUDIO_VOICE_COUNT)
+    return;
+  if (frequency == 0 || volume == 0)
+  {
+    audioRelease(voice);
+    return;
+  }
+
+  uint32_t samples = (uint32_t)durationMs * AUDIO_SAMPLE_RATE / 1000;
+
+  uint32_t irq = save_and_disable_interrupts();
+  Voice *v = &voices[voice];
+  if (!v->active)
+  {
+    v->phase = 0;
+    v->gain = 0;
+  }
+  else if (v->gain > volume * AUDIO_RAMP_SAMPLES)
+  {
+    v->gain = volume * AUDIO_RAMP_SAMPLES; // Nota encadeada mais baixa: sem recomeçar do zero
+  }
+  v->step = (((uint32_t)frequency << 16) / AUDIO_SAMPLE_RATE) << 16;
+  v->remaining = samples > AUDIO_RAMP_SAMPLES ? samples - AUDIO_RAMP_SAMPLES : (durationMs ? 1 : 0);
+  v->volume = volume;
+  v->releasing = false;
+  v->active = true;
+  startStreaming();
+  restore_interrupts(irq);
+}
+
+void audioRelease(AudioVoice voice)
+{
+  if (voice >= AUDIO_VOICE_COUNT)
+    return;
+
+  uint32_t irq = save_and_disable_interrupts();
+  voices[voice].releasing = true;
+  restore_interrupts(irq);
+}
+
+bool audioIsActive(void)
+{
+  return streaming;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file audio.h
+ * @brief Wavetable voices streamed to the buzzer as 8-bit PCM by PWM + DMA.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The buzzer PWM slice runs with an 8-bit wrap at full clock, and a DMA
+ * channel paced by a DMA timer writes one level per sample into its
+ * compare register. The channel plays a two-block ring: each time a block
+ * finishes, an interrupt re-arms the channel and mixes the voices into the
+ * block that just played. Once all voices end, the DMA stops by itself.
+ *
+ * Built only with -DPATROSUM_AUDIO_PCM=ON; the tone sequencer then plays
+ * its notes here instead of as square waves.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef AUDIO_SAMPLE_RATE
+#define AUDIO_SAMPLE_RATE 16000
+#endif
+
+/** Amostras por bloco do anel de DMA (16 ms a 16 kHz). */
+#define AUDIO_BLOCK_SAMPLES 256
+
+/** Subida e descida do volume, evitam estalos no começo e no fim das notas. */
+#define AUDIO_RAMP_SAMPLES 32
+
+#ifndef AUDIO_DEFAULT_VOLUME
+#define AUDIO_DEFAULT_VOLUME 160
+#endif
+
+typedef enum
+{
+  AUDIO_VOICE_MUSIC,  // Notas do sequenciador (jingle, erro)
+  AUDIO_VOICE_EFFECT, // Cliques das teclas, mixados por cima da música
+  AUDIO_VOICE_COUNT
+} AudioVoice;
+
+/**
+ * @brief Claims the DMA channel and timer and takes over the buzzer PWM slice.
+ */
+void initAudio(void);
+
+/**
+ * @brief Starts a note on a voice, replacing the one it was playing.
+ * @param frequency Hz; 0 releases the voice
+ * @param durationMs Length of the note including the release; 0 holds it until audioRelease()
+ * @param volume 0 to 255
+ */
+void audioTone(AudioVoice voice, uint16_t frequency, uint16_t durationMs, uint8_t volume);
+
+/**
+ * @brief Fades a voice out.
+ */
+void audioRelease(AudioVoice voice);
+
+/**
+ * @brief Whether the DMA is still streaming (a voice is sounding or fading).
+ */
+bool audioIsActive(void);
+
+#endif // AUDIO_H
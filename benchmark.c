@@ -0,0 +1,381 @@
+/**
+ * @file benchmark.c
+ * @brief On-device microbenchmarks for the PatroSum hot paths.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Built as the PatroSumBench target. Each benchmark runs a fixed number of
+ * iterations, timing every call with the SysTick cycle counter (24 bits,
+ * processor clock) and the whole run with time_us_64(). The results are
+ * printed as a table over USB stdio and the suite repeats every few seconds,
+ * so a regression after a patroLibs update shows up by simply reflashing.
+ *
+ * Every benchmark also runs a second, "cold" pass that flushes the XIP cache
+ * before each call, so code and constants still in flash are fetched over
+ * QSPI again. Its maximum is the worst-case frame cost; comparing it between
+ * a default build and a -DPATROSUM_COPY_TO_RAM=ON build shows what running
+ * from SRAM buys.
+ *
+ * A second table times real flushes on the display bus of the build (I2C,
+ * or SPI with -DPATROSUM_OLED_SPI=ON) at a few clocks: a full frame and a
+ * small change like a new answer digit, from the call until the last byte
+ * left the bus, with the data rate that gives.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/structs/systick.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/xip_ctrl.h"
+
+#include "buzzer.h"
+#include "keypad.h"
+#include "led.h"
+#include "approach.h"
+#include "oled.h"
+#include "oled_draw.h"
+#include "oled_text_cache.h"
+#include "render.h"
+#include "tween.h"
+
+#define BENCH_REPEAT_MS 10000 // Intervalo entre execuções da suíte
+#define BUS_FLUSH_RUNS 20      // Envios medidos por clock
+#define SYSTICK_MASK 0x00FFFFFFu
+
+#if PICO_COPY_TO_RAM
+#define BENCH_BINARY_TYPE "copy_to_ram"
+#else
+#define BENCH_BINARY_TYPE "flash (caminhos criticos na SRAM)"
+#endif
+
+typedef void (*BenchFn)(void);
+
+typedef struct
+{
+  const char *name;
+  BenchFn fn;
+  uint32_t iterations;
+} Benchmark;
+
+// Cenários fixos para os quadros completos
+static GameSnapshot hudSnapshot;
+static GameSnapshot resultSnapshot;
+static volatile float approachValue; // volatile: impede o compilador de descartar o cálculo
+static Tween benchTweenState;
+
+static void initSysTick(void)
+{
+  systick_hw->rvr = SYSTICK_MASK;
+  systick_hw->cvr = 0;
+  systick_hw->csr = 0x5; // Habilita, clock do processador, sem interrupção
+}
+
+static inline uint32_t readSysTick(void)
+{
+  return systick_hw->cvr;
+}
+
+static inline void flushXipCache(void)
+{
+  xip_ctrl_hw->flush = 1;
+  (void)xip_ctrl_hw->flush; // A leitura só retorna quando a limpeza termina
+}
+
+/**
+ * @brief Times a single call in processor cycles.
+ * Runs from SRAM so that, in the cold pass, only the misses of the code under
+ * test are counted, not those of the measuring loop.
+ * @param cold Flush the XIP cache right before the call
+ */
+static uint32_t __not_in_flash_func(timeCall)(BenchFn fn, bool cold)
+{
+  if (cold)
+    flushXipCache();
+
+  uint32_t t0 = readSysTick();
+  fn();
+  uint32_t t1 = readSysTick();
+
+  // SysTick conta para baixo
+  return (t0 - t1) & SYSTICK_MASK;
+}
+
+// -- Benchmarks
+
+static void benchEmpty(void) {}
+
+static void benchClear(void)
+{
+  oledClear();
+}
+
+static void benchTextCentered(void)
+{
+  oledDrawTextCentered("Resolva a conta:", 20);
+}
+
+static void benchTextUnaligned(void)
+{
+  oledDrawTextCentered("Resolva a conta:", 13);
+}
+
+static void benchTextCached(void)
+{
+  oledDrawTextCenteredCached("Resolva a conta:", 13);
+}
+
+static void benchRectangle(void)
+{
+  oledDrawRectangle(0, 0, OLED_WIDTH, 4);
+}
+
+static void benchRectanglePixels(void)
+{
+  oledDrawRectanglePixels(0, 0, OLED_WIDTH, 4);
+}
+
+static void benchShowFull(void)
+{
+  oledInvalidate();
+  oledShow();
+}
+
+static void benchShowIdle(void)
+{
+  oledShow(); // Nada mudou desde o último envio
+}
+
+static void benchKeypadScan(void)
+{
+  keypadScan();
+}
+
+static void benchPulseLed(void)
+{
+  pulseLed(LED_BLUE_PIN, 0.20);
+}
+
+static void benchApproach(void)
+{
+  approachValue = approach(approachValue, approachValue > 15 ? 12.0f : 20.0f, 1);
+}
+
+static void benchTween(void)
+{
+  // Mesmo movimento da pergunta, recomeçado quando termina
+  if (tweenDone(&benchTweenState))
+    tweenStart(&benchTweenState, TWEEN_FROM_INT(QUESTION_Y_IDLE), TWEEN_FROM_INT(QUESTION_Y_ANSWERING),
+               QUESTION_SLIDE_MS, EASE_OUT_QUAD);
+  tweenUpdate(&benchTweenState, 1000);
+}
+
+static void benchHudFrame(void)
+{
+  renderInvalidateScreen(); // Redesenha todos os widgets, como ao entrar na tela
+  renderDrawQuestionScreen(&hudSnapshot, 10000);
+}
+
+static void benchHudFrameIdle(void)
+{
+  renderDrawQuestionScreen(&hudSnapshot, 10000); // Nada mudou: nenhum widget é refeito
+}
+
+static void benchResultFrame(void)
+{
+  renderInvalidateScreen();
+  renderDrawResultScreen(&resultSnapshot);
+}
+
+// Clocks medidos no barramento do display
+#if PATROSUM_OLED_SPI
+static const uint32_t busClocks[] = {4000000, 8000000, OLED_SPI_BAUDRATE};
+#else
+static const uint32_t busClocks[] = {100000, 400000, 1000000};
+#endif
+
+static const Benchmark benchmarks[] = {
+    {"oledClear", benchClear, 1000},
+    {"drawTextCentered (alinhado)", benchTextCentered, 1000},
+    {"drawTextCentered (y=13)", benchTextUnaligned, 1000},
+    {"drawTextCenteredCached", benchTextCached, 1000},
+    {"drawRectangle 128x4", benchRectangle, 1000},
+    {"drawRectangle 128x4 (pixel)", benchRectanglePixels, 1000},
+    {"oledShow (quadro completo)", benchShowFull, 20},
+    {"oledShow (sem mudancas)", benchShowIdle, 1000},
+    {"keypadScan", benchKeypadScan, 100},
+    {"pulseLed", benchPulseLed, 1000},
+    {"approach", benchApproach, 1000},
+    {"tweenUpdate (Q8.8)", benchTween, 1000},
+    {"quadro HUD completo", benchHudFrame, 500},
+    {"quadro HUD (sem mudancas)", benchHudFrameIdle, 500},
+    {"tela de resultado", benchResultFrame, 500},
+};
+
+/**
+ * @brief Runs one benchmark and prints its table row.
+ * @param overhead Cycles measured for an empty call, subtracted from each sample
+ */
+static void runBenchmark(const Benchmark *b, uint32_t overhead)
+{
+  uint32_t minCycles = UINT32_MAX, maxCycles = 0;
+  uint64_t totalCycles = 0;
+
+  uint64_t startUs = time_us_64();
+  for (uint32_t i = 0; i < b->iterations; i++)
+  {
+    uint32_t cycles = timeCall(b->fn, false);
+    cycles = cycles > overhead ? cycles - overhead : 0;
+
+    totalCycles += cycles;
+    if (cycles < minCycles)
+      minCycles = cycles;
+    if (cycles > maxCycles)
+      maxCycles = cycles;
+  }
+  uint64_t elapsedUs = time_us_64() - startUs;
+
+  // Passada fria: cada chamada começa com a cache XIP vazia
+  uint32_t coldMaxCycles = 0;
+  uint64_t coldTotalCycles = 0;
+  for (uint32_t i = 0; i < b->iterations; i++)
+  {
+    uint32_t cycles = timeCall(b->fn, true);
+    cycles = cycles > overhead ? cycles - overhead : 0;
+
+    coldTotalCycles += cycles;
+    if (cycles > coldMaxCycles)
+      coldMaxCycles = cycles;
+  }
+
+  uint32_t avgCycles = (uint32_t)(totalCycles / b->iterations);
+  printf("%-30s %6lu %10lu %10lu %10lu %10lu %10lu %10.2f\n",
+         b->name,
+         (unsigned long)b->iterations,
+         (unsigned long)minCycles,
+         (unsigned long)avgCycles,
+         (unsigned long)maxCycles,
+         (unsigned long)(coldTotalCycles / b->iterations),
+         (unsigned long)coldMaxCycles,
+         (double)elapsedUs / b->iterations);
+}
+
+/**
+ * @brief Average time of one flush, from the call until the bus is idle.
+ * @param full Whole frame; otherwise a 24x8 block changes, like an answer digit
+ * @param bytesPerFlush Receives the data bytes each flush sent
+ */
+static uint32_t timeFlushUs(bool full, uint32_t *bytesPerFlush)
+{
+  const OledStats *stats = oledGetStats();
+  uint32_t bytesBefore = stats->bytesSent;
+  uint64_t totalUs = 0;
+
+  for (int i = 0; i < BUS_FLUSH_RUNS; i++)
+  {
+    if (full)
+      oledInvalidate();
+    else
+      oledFillRect(52, 40, 76, 48, i % 2 == 0);
+
+    uint64_t startUs = time_us_64();
+    oledShowAsync(NULL);
+    oledWaitIdle();
+    totalUs += time_us_64() - startUs;
+  }
+
+  *bytesPerFlush = (stats->bytesSent - bytesBefore) / BUS_FLUSH_RUNS;
+  return (uint32_t)(totalUs / BUS_FLUSH_RUNS);
+}
+
+/**
+ * @brief Prints the flush time and data rate of the display bus at each clock.
+ */
+static void runBusReport(void)
+{
+  uint32_t configuredHz = oledGetBusClock();
+
+  printf("\n%-8s %10s %14s %12s %14s\n", oledBusName(), "clock Hz", "quadro (us)", "bytes/s", "digito (us)");
+  for (size_t i = 0; i < count_of(busClocks); i++)
+  {
+    uint32_t hz = oledSetBusClock(busClocks[i]);
+    if (hz == 0)
+    {
+      printf("%-8s %10lu  sem resposta do painel\n", "", (unsigned long)busClocks[i]);
+      continue;
+    }
+
+    uint32_t fullBytes, partialBytes;
+    uint32_t fullUs = timeFlushUs(true, &fullBytes);
+    uint32_t partialUs = timeFlushUs(false, &partialBytes);
+    printf("%-8s %10lu %14lu %12.0f %14lu\n", "", (unsigned long)hz, (unsigned long)fullUs,
+           fullUs ? fullBytes * 1e6 / fullUs : 0.0, (unsigned long)partialUs);
+  }
+
+  oledSetBusClock(configuredHz);
+  oledClear();
+  oledShow();
+}
+
+static uint32_t measureOverhead(void)
+{
+  uint32_t best = UINT32_MAX;
+  for (int i = 0; i < 100; i++)
+  {
+    uint32_t cycles = timeCall(benchEmpty, false);
+    if (cycles < best)
+      best = cycles;
+  }
+  return best;
+}
+
+static void setupScenarios(void)
+{
+  memset(&hudSnapshot, 0, sizeof(hudSnapshot));
+  hudSnapshot.state = WAITING_FOR_INPUT;
+  strcpy(hudSnapshot.questionStr, "999 + 999 = ?");
+  hudSnapshot.questionLen = strlen(hudSnapshot.questionStr);
+  numberInputClear(&hudSnapshot.answer);
+  for (const char *d = "1998"; *d; d++)
+    numberInputAppend(&hudSnapshot.answer, (uint8_t)(*d - '0'));
+
+  memset(&resultSnapshot, 0, sizeof(resultSnapshot));
+  resultSnapshot.state = SHOWING_RESULT;
+  resultSnapshot.correctAnswer = 1998;
+  resultSnapshot.lastAnswerCorrect = false;
+}
+
+int main()
+{
+  stdio_init_all();
+  initBuzzerPWM();
+  initKeypad();
+  oledInit();
+  oledShow(); // Painel limpo antes das medições
+  initLeds();
+  initSysTick();
+  setupScenarios();
+
+  // Dá tempo para o host abrir a porta serial
+  while (!stdio_usb_connected())
+    sleep_ms(100);
+
+  while (true)
+  {
+    uint32_t overhead = measureOverhead();
+
+    printf("\nPatroSum bench @ %lu MHz, %s (overhead %lu ciclos descontado)\n",
+           (unsigned long)(clock_get_hz(clk_sys) / 1000000), BENCH_BINARY_TYPE, (unsigned long)overhead);
+    printf("%-30s %6s %10s %10s %10s %10s %10s %10s\n",
+           "benchmark", "iter", "min cyc", "avg cyc", "max cyc", "cold avg", "cold max", "us/iter");
+
+    for (size_t i = 0; i < count_of(benchmarks); i++)
+      runBenchmark(&benchmarks[i], overhead);
+    runBusReport();
+
+    sleep_ms(BENCH_REPEAT_MS);
+  }
+}
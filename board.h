@@ -0,0 +1,140 @@
+/**
+ * @file board.h
+ * @brief Pins, keymap and display geometry of the board, fixed at compile time.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Every module takes its wiring from here instead of keeping its own copy.
+ * The defaults describe the BitDogLab. Another board sets the CMake cache
+ * variable PATROSUM_BOARD_HEADER to a header that defines only what differs;
+ * anything it leaves out keeps the default below. Since all of it is made of
+ * integer literals, the pin masks and the wiring checks are worked out by the
+ * preprocessor and cost nothing at run time.
+ *
+ * The RGB LED pins (LED_RED_PIN, LED_GREEN_PIN, LED_BLUE_PIN) stay in the
+ * patroLibs led.h, whose initLeds() configures them.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef BOARD_H
+#define BOARD_H
+
+#ifdef PATROSUM_BOARD_HEADER
+#include PATROSUM_BOARD_HEADER
+#endif
+
+// Teclado matricial 4x4
+
+#define KEYPAD_ROWS 4
+#define KEYPAD_COLS 4
+
+// Linhas (saídas, ativas em nível baixo). Devem coincidir com a ligação usada por initKeypad().
+#ifndef KEYPAD_ROW0_PIN
+#define KEYPAD_ROW0_PIN 4
+#endif
+#ifndef KEYPAD_ROW1_PIN
+#define KEYPAD_ROW1_PIN 8
+#endif
+#ifndef KEYPAD_ROW2_PIN
+#define KEYPAD_ROW2_PIN 9
+#endif
+#ifndef KEYPAD_ROW3_PIN
+#define KEYPAD_ROW3_PIN 16
+#endif
+
+// Colunas (entradas com pull-up)
+#ifndef KEYPAD_COL0_PIN
+#define KEYPAD_COL0_PIN 17
+#endif
+#ifndef KEYPAD_COL1_PIN
+#define KEYPAD_COL1_PIN 18
+#endif
+#ifndef KEYPAD_COL2_PIN
+#define KEYPAD_COL2_PIN 19
+#endif
+#ifndef KEYPAD_COL3_PIN
+#define KEYPAD_COL3_PIN 20
+#endif
+
+#define KEYPAD_ROW_PINS {KEYPAD_ROW0_PIN, KEYPAD_ROW1_PIN, KEYPAD_ROW2_PIN, KEYPAD_ROW3_PIN}
+#define KEYPAD_COL_PINS {KEYPAD_COL0_PIN, KEYPAD_COL1_PIN, KEYPAD_COL2_PIN, KEYPAD_COL3_PIN}
+
+/** Máscaras de GPIO das linhas e das colunas. */
+#define KEYPAD_ROW_MASK ((1u << KEYPAD_ROW0_PIN) | (1u << KEYPAD_ROW1_PIN) | \
+                         (1u << KEYPAD_ROW2_PIN) | (1u << KEYPAD_ROW3_PIN))
+#define KEYPAD_COL_MASK ((1u << KEYPAD_COL0_PIN) | (1u << KEYPAD_COL1_PIN) | \
+                         (1u << KEYPAD_COL2_PIN) | (1u << KEYPAD_COL3_PIN))
+
+/** 1 se os pinos estão em sequência: as colunas saem de um só deslocamento e a PIO pode varrer. */
+#define KEYPAD_ROWS_CONSECUTIVE (KEYPAD_ROW1_PIN == KEYPAD_ROW0_PIN + 1 && \
+                                 KEYPAD_ROW2_PIN == KEYPAD_ROW0_PIN + 2 && \
+                                 KEYPAD_ROW3_PIN == KEYPAD_ROW0_PIN + 3)
+#define KEYPAD_COLS_CONSECUTIVE (KEYPAD_COL1_PIN == KEYPAD_COL0_PIN + 1 && \
+                                 KEYPAD_COL2_PIN == KEYPAD_COL0_PIN + 2 && \
+                                 KEYPAD_COL3_PIN == KEYPAD_COL0_PIN + 3)
+
+/** Caractere impresso em cada tecla, linha a linha. */
+#ifndef KEYPAD_KEYMAP
+#define KEYPAD_KEYMAP {           \
+    {'1', '2', '3', 'A'},         \
+    {'4', '5', '6', 'B'},         \
+    {'7', '8', '9', 'C'},         \
+    {'*', '0', '#', 'D'}}
+#endif
+
+// Display SSD1306
+
+/** Tamanho do painel: 128x64 ou 128x32 (as telas do jogo foram desenhadas para 128x64). */
+#ifndef OLED_WIDTH
+#define OLED_WIDTH 128
+#endif
+#ifndef OLED_HEIGHT
+#define OLED_HEIGHT 64
+#endif
+
+// I2C
+#ifndef OLED_I2C
+#define OLED_I2C i2c1
+#endif
+#ifndef OLED_SDA_PIN
+#define OLED_SDA_PIN 14
+#endif
+#ifndef OLED_SCL_PIN
+#define OLED_SCL_PIN 15
+#endif
+#ifndef OLED_I2C_ADDRESS
+#define OLED_I2C_ADDRESS 0x3C
+#endif
+
+// Ligação por SPI de 4 fios (PATROSUM_OLED_SPI), para painéis montados assim
+#ifndef OLED_SPI
+#define OLED_SPI spi0
+#endif
+#ifndef OLED_SPI_SCK_PIN
+#define OLED_SPI_SCK_PIN 2
+#endif
+#ifndef OLED_SPI_MOSI_PIN
+#define OLED_SPI_MOSI_PIN 3
+#endif
+#ifndef OLED_SPI_CS_PIN
+#define OLED_SPI_CS_PIN 1
+#endif
+#ifndef OLED_SPI_DC_PIN
+#define OLED_SPI_DC_PIN 0
+#endif
+#ifndef OLED_SPI_RESET_PIN
+#define OLED_SPI_RESET_PIN 28
+#endif
+
+// Outros periféricos
+
+#ifndef BUZZER_PIN
+#define BUZZER_PIN 21 // Buzzer A da BitDogLab
+#endif
+
+#ifndef LATENCY_TRACE_PIN
+#define LATENCY_TRACE_PIN -1 // GPIO alternado a cada etapa do traço de latência (-1 = sem pino)
+#endif
+
+#endif // BOARD_H
@@ -0,0 +1,101 @@
+/**
+ * @file frame_scheduler.c
+ * @brief Fixed-rate frame scheduler with frame-time statistics.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "frame_scheduler.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+static void resetStats(FrameStats *stats)
+{
+  memset(stats, 0, sizeof(*stats));
+  stats->minUs = UINT32_MAX;
+}
+
+static void reportStats(FrameScheduler *fs, absolute_time_t now)
+{
+  const FrameStats *st = &fs->stats;
+  if (st->frames == 0)
+    return;
+
+  printf("[%s] %lu quadros, trabalho min/med/max = %lu/%lu/%lu us, prazo perdido: %lu\n",
+         fs->name,
+         (unsigned long)st->frames,
+         (unsigned long)st->minUs,
+         (unsigned long)(st->totalUs / st->frames),
+         (unsigned long)st->maxUs,
+         (unsigned long)st->missed);
+
+  resetStats(&fs->stats);
+  fs->lastReport = now;
+}
+
+void frameSchedulerInit(FrameScheduler *fs, const char *name, uint32_t rateHz)
+{
+  absolute_time_t now = get_absolute_time();
+
+  fs->name = name;
+  fs->periodUs = 1000000u / rateHz;
+  fs->frameStart = now;
+  fs->deadline = delayed_by_us(now, fs->periodUs);
+  fs->lastReport = now;
+  resetStats(&fs->stats);
+}
+
+uint32_t frameBegin(FrameScheduler *fs)
+{
+  absolute_time_t now = get_absolute_time();
+  uint32_t dt = (uint32_t)absolute_time_diff_us(fs->frameStart, now);
+  fs->frameStart = now;
+  return dt;
+}
+
+void frameEnd(FrameScheduler *fs)
+{
+  absolute_time_t now = get_absolute_time();
+  uint32_t work = (uint32_t)absolute_time_diff_us(fs->frameStart, now);
+
+  FrameStats *st = &fs->stats;
+  st->frames++;
+  st->totalUs += work;
+  if (work < st->minUs)
+    st->minUs = work;
+  if (work > st->maxUs)
+    st->maxUs = work;
+
+#if FRAME_STATS_INTERVAL_MS > 0
+  if (absolute_time_diff_us(fs->lastReport, now) >= (int64_t)FRAME_STATS_INTERVAL_MS * 1000)
+    reportStats(fs, now);
+#endif
+
+  if (time_reached(fs->deadline))
+  {
+    // Atrasou: conta o prazo perdido e recomeça a grade a partir de agora
+    st->missed++;
+    fs->deadline = delayed_by_us(get_absolute_time(), fs->periodUs);
+    return;
+  }
+
+  sleep_until(fs->deadline);
+  fs->deadline = delayed_by_us(fs->deadline, fs->periodUs);
+}
+
+void frameSchedulerResync(FrameScheduler *fs)
+{
+  absolute_time_t now = get_absolute_time();
+  fs->frameStart = now;
+  fs->deadline = delayed_by_us(now, fs->periodUs);
+}
+
+const FrameStats *frameSchedulerStats(const FrameScheduler *fs)
+{
+  return &fs->stats;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file frame_scheduler.h
+ * @brief Fixed-rate frame scheduler with frame-time statistics.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Each loop calls frameBegin() to get the time elapsed since the previous
+ * frame (delta-time) and frameEnd() to record how long the work took and to
+ * sleep until the next deadline. Deadlines are kept on a fixed grid, so the
+ * rate doesn't drift with the amount of work per frame; a frame that runs
+ * past its deadline is counted as missed and the grid restarts from now.
+ *
+ * Min/avg/max work time and missed deadlines are printed over stdio every
+ * FRAME_STATS_INTERVAL_MS (0 disables the report).
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <stdint.h>
+
+#include "pico/time.h"
+
+#ifndef FRAME_STATS_INTERVAL_MS
+#define FRAME_STATS_INTERVAL_MS 5000
+#endif
+
+/**
+ * @brief Frame-time counters for one reporting interval.
+ */
+typedef struct
+{
+  uint32_t frames;
+  uint32_t missed;   // Quadros que passaram do prazo
+  uint32_t minUs;    // Menor tempo de trabalho
+  uint32_t maxUs;    // Maior tempo de trabalho
+  uint64_t totalUs;  // Soma, para a média
+} FrameStats;
+
+typedef struct
+{
+  const char *name;
+  uint32_t periodUs;
+  absolute_time_t deadline;    // Fim do quadro atual
+  absolute_time_t frameStart;  // Início do quadro atual
+  absolute_time_t lastReport;
+  FrameStats stats;
+} FrameScheduler;
+
+/**
+ * @brief Prepares a scheduler.
+ * @param name Label used in the stdio report
+ * @param rateHz Target frames per second
+ */
+void frameSchedulerInit(FrameScheduler *fs, const char *name, uint32_t rateHz);
+
+/**
+ * @brief Marks the start of a frame.
+ * @return Microseconds since the previous frame started (delta-time)
+ */
+uint32_t frameBegin(FrameScheduler *fs);
+
+/**
+ * @brief Records the frame's work time and sleeps until the next deadline.
+ */
+void frameEnd(FrameScheduler *fs);
+
+/**
+ * @brief Restarts the deadline grid from now, e.g. after the loop slept for a
+ * long time on purpose, so the pause is neither a missed deadline nor a huge dt.
+ */
+void frameSchedulerResync(FrameScheduler *fs);
+
+/**
+ * @brief Returns the counters of the current reporting interval.
+ */
+const FrameStats *frameSchedulerStats(const FrameScheduler *fs);
+
+#endif // FRAME_SCHEDULER_H
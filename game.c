@@ -0,0 +1,467 @@
+/**
+ * @file game.c
+ * @brief Question generation, answer input and result timing.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "game.h"
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "keypad_events.h"
+#include "tone_sequencer.h"
+#include "question_pool.h"
+#include "latency_trace.h"
+#include "stats_store.h"
+#include "speed_round.h"
+#include "player.h"
+
+#if PATROSUM_TELEMETRY
+#include "telemetry.h"
+#endif
+
+const char keypad_key_map[KEYPAD_ROWS][KEYPAD_COLS] = KEYPAD_KEYMAP;
+
+// Sons de feedback, tocados em segundo plano pelo sequenciador
+static const ToneNote successJingle[] = {
+    {523, 150, 100}, // C5
+    {659, 150, 100}, // E5
+    {784, 150, 0}};  // G5
+static const ToneNote errorTone[] = {
+    {261, 500, 0}}; // C4 (som de erro)
+
+// Teclas de letra livres escolhem o tipo de conta
+static const struct
+{
+  char key;
+  QuestionKind kind;
+} kindKeys[] = {
+    {'B', QUESTION_ADDITION},
+    {'C', QUESTION_SUBTRACTION},
+    {'D', QUESTION_MULTIPLICATION},
+};
+
+static const Question noQuestion = {0}; // Antes da primeira pergunta
+
+/**
+ * @brief One seat of the hot-seat mode: its own answer and score.
+ */
+typedef struct
+{
+  NumberInput answer;
+  PlayerScore score;
+} Player;
+
+/**
+ * @brief Everything the state machine reads and writes, in one place.
+ */
+typedef struct
+{
+  GameState state;
+  QuestionKind kind;
+  const Question *question;        // Slot do anel de perguntas prontas
+  uint32_t questionId;             // Muda a cada pergunta
+  Player players[MAX_PLAYERS];     // Só os playerCount primeiros jogam
+  uint8_t playerCount;
+  uint8_t turn;                    // Jogador da pergunta atual
+  bool clearHeld;                  // '*' pressionado: um dígito junto escolhe os jogadores
+  absolute_time_t questionShownAt; // Início do tempo de resposta
+  absolute_time_t answerHintUntil; // Até quando mostrar "Digite a resposta"
+  absolute_time_t resultShownAt;
+  bool lastAnswerCorrect;
+  uint32_t responseUs; // Da pergunta no painel até o 'A'
+  GameStats stats;     // Persistidas na flash (stats_store.h)
+
+  // Rodada cronometrada ('#')
+  bool speedRound;
+  absolute_time_t roundEndsAt;
+  SpeedScore roundScore;
+  SpeedLeaderboard leaderboard;
+  int8_t leaderboardRank;
+  absolute_time_t leaderboardShownAt;
+} GameContext;
+
+/**
+ * @brief Handlers of one state; any of them may be NULL.
+ * The screens of each state are drawn by render.c from the snapshot.
+ */
+typedef struct
+{
+  void (*enter)(GameContext *ctx);
+  void (*update)(GameContext *ctx);
+  void (*exit)(GameContext *ctx);
+} StateHandlers;
+
+static GameContext game;
+
+static void changeState(GameContext *ctx, GameState next);
+
+/**
+ * @brief Answer being typed by the player whose turn it is.
+ */
+static NumberInput *activeAnswer(GameContext *ctx)
+{
+  return &ctx->players[ctx->turn].answer;
+}
+
+/**
+ * @brief Sets how many players take turns; scores restart from zero.
+ */
+static void setPlayerCount(GameContext *ctx, uint8_t count)
+{
+  if (count == ctx->playerCount || ctx->speedRound) // A rodada cronometrada é só do jogo solo
+    return;
+  ctx->playerCount = count;
+  ctx->turn = 0;
+  for (int p = 0; p < MAX_PLAYERS; p++)
+  {
+    numberInputClear(&ctx->players[p].answer);
+    playerScoreReset(&ctx->players[p].score);
+  }
+  playEffect(count > 1 ? 880 : 660, 80);
+  changeState(ctx, GENERATE_NEW_QUESTION);
+}
+
+/**
+ * @brief Routes one keypad event, the same way in every state.
+ * Tracks whether '*' is held, so '*' + digit can set the player count.
+ * @return The key pressed, or 0 for releases and for chords already handled
+ */
+static char dispatchKey(GameContext *ctx, const KeypadEvent *evt)
+{
+  char key = keypad_key_map[evt->row][evt->col];
+  if (key == '*')
+    ctx->clearHeld = evt->pressed;
+  if (!evt->pressed)
+    return 0; // Só interessa o momento em que a tecla é pressionada
+
+  if (ctx->clearHeld && key >= '1' && key < '1' + MAX_PLAYERS)
+  {
+    setPlayerCount(ctx, (uint8_t)(key - '0'));
+    return 0;
+  }
+  return key;
+}
+
+// -- GENERATE_NEW_QUESTION: pega a próxima pergunta pronta
+
+static void updateGenerate(GameContext *ctx)
+{
+  ctx->question = questionPoolNext();
+  ctx->questionId++;
+  numberInputClear(activeAnswer(ctx)); // Limpa a resposta anterior
+  changeState(ctx, WAITING_FOR_INPUT);
+}
+
+// -- WAITING_FOR_INPUT: monta a resposta tecla a tecla
+
+static void enterWaiting(GameContext *ctx)
+{
+  ctx->questionShownAt = get_absolute_time();
+}
+
+/**
+ * @brief Switches the kind of question and moves on to one of the new kind.
+ */
+static void selectKind(GameContext *ctx, QuestionKind kind)
+{
+  if (kind == ctx->kind)
+    return;
+  ctx->kind = kind;
+  questionPoolSetKind(kind);
+  playEffect(660, 80);
+  changeState(ctx, GENERATE_NEW_QUESTION);
+}
+
+/**
+ * @brief Starts a timed round, or abandons the current one (no score).
+ */
+static void toggleSpeedRound(GameContext *ctx)
+{
+  if (ctx->playerCount > 1)
+    return; // Com vários jogadores o placar é a vez de cada um
+  ctx->speedRound = !ctx->speedRound;
+  if (ctx->speedRound)
+  {
+    ctx->roundEndsAt = make_timeout_time_ms(SPEED_ROUND_MS);
+    speedScoreReset(&ctx->roundScore);
+    playEffect(880, 80);
+  }
+  else
+  {
+    playEffect(220, 80);
+  }
+  changeState(ctx, GENERATE_NEW_QUESTION); // A rodada começa com uma conta nova
+}
+
+/**
+ * @brief Ends the round once its time is up.
+ * @return true if the state changed to the leaderboard
+ */
+static bool speedRoundExpired(GameContext *ctx)
+{
+  if (!ctx->speedRound || !time_reached(ctx->roundEndsAt))
+    return false;
+  changeState(ctx, SHOWING_LEADERBOARD);
+  return true;
+}
+
+/**
+ * @brief Time from the first frame showing the question to the key scan.
+ */
+static uint32_t responseTimeUs(const GameContext *ctx, uint32_t keyUs)
+{
+  uint32_t shownUs;
+  if (!readQuestionShown(ctx->questionId, &shownUs))
+    shownUs = (uint32_t)to_us_since_boot(ctx->questionShownAt); // Sem desenho (ou ainda no envio)
+
+  int32_t elapsed = (int32_t)(keyUs - shownUs); // Diferença em 32 bits: vale mesmo com o contador dando a volta
+  return elapsed > 0 ? (uint32_t)elapsed : 0;   // Teclas digitadas antes da pergunta aparecer contam como 0
+}
+
+static void updateWaiting(GameContext *ctx)
+{
+  if (speedRoundExpired(ctx))
+    return;
+
+  // Consome todas as teclas capturadas desde o último quadro
+  KeypadEvent evt;
+  while (ctx->state == WAITING_FOR_INPUT && keypadPollEvent(&evt))
+  {
+    char key = dispatchKey(ctx, &evt);
+    if (!key)
+      continue;
+    LATENCY_MARK(LATENCY_INPUT);
+
+    NumberInput *answer = activeAnswer(ctx);
+
+    // Se for um dígito, adiciona à resposta (o valor é atualizado junto)
+    if (key >= '0' && key <= '9')
+    {
+      if (numberInputAppend(answer, (uint8_t)(key - '0')))
+        playEffect(440, 50); // Beep de feedback
+    }
+    // Se for 'A', vai para a verificação
+    else if (key == 'A')
+    {
+      if (answer->digits == 0)
+      {
+        ctx->answerHintUntil = make_timeout_time_ms(1000); // Mostra o aviso sem travar o loop
+        continue;                                          // Volta para esperar mais input
+      }
+      ctx->responseUs = responseTimeUs(ctx, evt.timestamp_us);
+      changeState(ctx, CHECK_ANSWER);
+    }
+    // Se for '*', limpa a resposta
+    else if (key == '*')
+    {
+      numberInputClear(answer);
+      playEffect(220, 50); // Beep diferente para limpar
+    }
+    else if (key == '#')
+    {
+      toggleSpeedRound(ctx);
+    }
+    else if (!ctx->speedRound) // O tipo de conta fica fixo durante a rodada
+    {
+      for (size_t i = 0; i < count_of(kindKeys); i++)
+        if (key == kindKeys[i].key)
+          selectKind(ctx, kindKeys[i].kind);
+    }
+  }
+
+  if (ctx->state == WAITING_FOR_INPUT)
+    questionPoolTopUp(); // Prepara a próxima pergunta enquanto o jogador pensa
+}
+
+// -- CHECK_ANSWER: compara, toca o som e atualiza as estatísticas
+
+static void updateCheck(GameContext *ctx)
+{
+  // O valor foi montado a cada dígito: a verificação é uma comparação
+  const NumberInput *answer = activeAnswer(ctx);
+  ctx->lastAnswerCorrect = (answer->value == ctx->question->answer);
+  if (ctx->lastAnswerCorrect)
+    playTones(successJingle, count_of(successJingle));
+  else
+    playTones(errorTone, count_of(errorTone));
+
+  PlayerScore *score = &ctx->players[ctx->turn].score;
+  playerScoreRecord(score, ctx->lastAnswerCorrect);
+
+  // A flash guarda o placar da placa; a sequência salva é a do jogo solo
+  GameStats *stats = &ctx->stats;
+  stats->answered++;
+  if (ctx->lastAnswerCorrect)
+    stats->correct++;
+  if (ctx->playerCount == 1)
+    stats->streak = ctx->lastAnswerCorrect ? stats->streak + 1 : 0;
+  uint16_t streak = ctx->playerCount == 1 ? stats->streak : score->streak;
+  if (streak > stats->bestStreak)
+    stats->bestStreak = streak; // O recorde vale para qualquer jogador
+  statsStoreSave(stats); // Só na RAM; vai para a flash na tela de resultado
+
+  if (ctx->speedRound)
+    speedScoreRecord(&ctx->roundScore, ctx->lastAnswerCorrect, ctx->responseUs);
+
+#if PATROSUM_TELEMETRY
+  // Só guarda no anel; o envio fica para telemetryPoll()
+  const Question *q = ctx->question;
+  telemetryRecordAnswer(q->op, q->a, q->b, q->answer, answer->value, ctx->responseUs / 1000);
+#endif
+
+  changeState(ctx, SHOWING_RESULT);
+}
+
+// -- SHOWING_RESULT: o resultado fica na tela sem travar o loop
+
+static void enterResult(GameContext *ctx)
+{
+  ctx->resultShownAt = get_absolute_time();
+}
+
+static void updateResult(GameContext *ctx)
+{
+  if (speedRoundExpired(ctx))
+    return;
+
+  int64_t elapsed_ms = absolute_time_diff_us(ctx->resultShownAt, get_absolute_time()) / 1000;
+  int64_t limit_ms = ctx->speedRound ? SPEED_RESULT_MS : RESULT_SCREEN_MS; // Na rodada o relógio não para
+
+  // 'A' pula para a próxima conta
+  bool skip = false;
+  KeypadEvent evt;
+  while (ctx->state == SHOWING_RESULT && keypadPollEvent(&evt))
+  {
+    if (dispatchKey(ctx, &evt) == 'A')
+      skip = true;
+  }
+  if (ctx->state != SHOWING_RESULT)
+    return; // O número de jogadores mudou: já há outra pergunta
+  if (skip || elapsed_ms >= limit_ms)
+  {
+    ctx->turn = (uint8_t)((ctx->turn + 1) % ctx->playerCount); // A próxima conta é do próximo jogador
+    changeState(ctx, GENERATE_NEW_QUESTION);
+  }
+  else if (!isTonePlaying() && !ctx->speedRound) // Na rodada, nem uma gravação de página deve atrasar a varredura
+    statsStorePoll(); // Ninguém digita e nenhum som depende de interrupções agora
+}
+
+// -- SHOWING_LEADERBOARD: fim da rodada cronometrada
+
+static void enterLeaderboard(GameContext *ctx)
+{
+  ctx->speedRound = false;
+  ctx->leaderboardRank = (int8_t)speedLeaderboardInsert(&ctx->leaderboard, &ctx->roundScore);
+  ctx->leaderboardShownAt = get_absolute_time();
+  if (ctx->leaderboardRank >= 0)
+    playTones(successJingle, count_of(successJingle));
+  else
+    playEffect(440, 150);
+}
+
+static void updateLeaderboard(GameContext *ctx)
+{
+  int64_t elapsed_ms = absolute_time_diff_us(ctx->leaderboardShownAt, get_absolute_time()) / 1000;
+
+  // 'A' volta ao jogo normal
+  bool skip = false;
+  KeypadEvent evt;
+  while (ctx->state == SHOWING_LEADERBOARD && keypadPollEvent(&evt))
+  {
+    if (dispatchKey(ctx, &evt) == 'A')
+      skip = true;
+  }
+  if (ctx->state != SHOWING_LEADERBOARD)
+    return;
+  if (skip || elapsed_ms >= SPEED_LEADERBOARD_MS)
+    changeState(ctx, GENERATE_NEW_QUESTION);
+  else if (!isTonePlaying())
+    statsStorePoll(); // As estatísticas da rodada vão para a flash aqui
+}
+
+static const StateHandlers stateTable[GAME_STATE_COUNT] = {
+    [GENERATE_NEW_QUESTION] = {NULL, updateGenerate, NULL},
+    [WAITING_FOR_INPUT] = {enterWaiting, updateWaiting, NULL},
+    [CHECK_ANSWER] = {NULL, updateCheck, NULL},
+    [SHOWING_RESULT] = {enterResult, updateResult, NULL},
+    [SHOWING_LEADERBOARD] = {enterLeaderboard, updateLeaderboard, NULL},
+};
+
+static void changeState(GameContext *ctx, GameState next)
+{
+  if (stateTable[ctx->state].exit)
+    stateTable[ctx->state].exit(ctx);
+  ctx->state = next;
+  if (stateTable[next].enter)
+    stateTable[next].enter(ctx);
+}
+
+void gameInit(uint64_t seed)
+{
+  questionPoolInit(seed);
+
+  game.state = GENERATE_NEW_QUESTION;
+  game.kind = QUESTION_ADDITION;
+  game.question = &noQuestion;
+  game.questionId = 0;
+  for (int p = 0; p < MAX_PLAYERS; p++)
+  {
+    numberInputClear(&game.players[p].answer);
+    playerScoreReset(&game.players[p].score);
+  }
+  game.playerCount = 1;
+  game.turn = 0;
+  game.clearHeld = false;
+  game.questionShownAt = nil_time;
+  game.answerHintUntil = nil_time;
+  game.resultShownAt = nil_time;
+  game.lastAnswerCorrect = false;
+  game.responseUs = 0;
+  game.speedRound = false;
+  game.roundEndsAt = nil_time;
+  speedScoreReset(&game.roundScore);
+  speedLeaderboardClear(&game.leaderboard);
+  game.leaderboardRank = -1;
+  game.leaderboardShownAt = nil_time;
+  statsStoreLoad(&game.stats); // Placar e recorde da última sessão
+}
+
+void gameUpdate(void)
+{
+  // Um passo do estado atual; as trocas de estado chamam exit/enter na hora
+  stateTable[game.state].update(&game);
+}
+
+void gameForgetHeldKeys(void)
+{
+  game.clearHeld = false;
+}
+
+void gameFillSnapshot(GameSnapshot *snapshot)
+{
+  const GameContext *ctx = &game;
+  snapshot->state = ctx->state;
+  snapshot->questionId = ctx->questionId;
+  memcpy(snapshot->questionStr, ctx->question->text, sizeof(ctx->question->text));
+  snapshot->questionLen = ctx->question->length;
+  snapshot->answer = ctx->players[ctx->turn].answer;
+  snapshot->correctAnswer = ctx->question->answer;
+  snapshot->lastAnswerCorrect = ctx->lastAnswerCorrect;
+  snapshot->answerHintUntil = ctx->answerHintUntil;
+  snapshot->streak = ctx->stats.streak;
+  snapshot->bestStreak = ctx->stats.bestStreak;
+  snapshot->speedRound = ctx->speedRound;
+  snapshot->roundEndsAt = ctx->roundEndsAt;
+  snapshot->roundScore = ctx->roundScore;
+  snapshot->leaderboard = ctx->leaderboard;
+  snapshot->leaderboardRank = ctx->leaderboardRank;
+  snapshot->playerCount = ctx->playerCount;
+  snapshot->activePlayer = ctx->turn;
+  for (int p = 0; p < MAX_PLAYERS; p++)
+    snapshot->players[p] = ctx->players[p].score;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file game.h
+ * @brief PatroSum game state machine, independent of the board setup.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The game only talks to the hardware through the keypad event queue, the
+ * tone sequencer and the pico time functions, so the same code runs on the
+ * RP2040 and in the host simulator (host/), where those are backed by a
+ * scripted keypad, a sound log and a virtual clock.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef GAME_H
+#define GAME_H
+
+#include <stdint.h>
+
+#include "board.h"
+#include "game_snapshot.h"
+
+/** Tempo máximo exibindo o resultado. */
+#define RESULT_SCREEN_MS 2000
+
+/**
+ * @brief Mapa de teclas para o teclado 4x4.
+ * Cada posição corresponde ao caractere exibido na tecla.
+ */
+extern const char keypad_key_map[KEYPAD_ROWS][KEYPAD_COLS];
+
+/**
+ * @brief Resets the state machine to the start of a new round.
+ * Does not touch the hardware.
+ * @param seed Seed for the question generator (same seed, same questions)
+ */
+void gameInit(uint64_t seed);
+
+/**
+ * @brief Runs one iteration of the state machine.
+ * Consumes the pending keypad events and queues the feedback sounds.
+ */
+void gameUpdate(void);
+
+/**
+ * @brief Forgets the keys the game believes are held (the '*' of the
+ * player-count chord). Call after keypadFlushEvents(), which may have
+ * discarded their releases.
+ */
+void gameForgetHeldKeys(void);
+
+/**
+ * @brief Copies the state the render pipeline depends on into a snapshot.
+ */
+void gameFillSnapshot(GameSnapshot *snapshot);
+
+#endif // GAME_H
@@ -0,0 +1,67 @@
+/**
+ * @file game_snapshot.c
+ * @brief Seqlock-protected game snapshot shared between cores.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "game_snapshot.h"
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+// Ímpar enquanto uma escrita está em andamento
+static volatile uint32_t snapshotSeq = 0;
+static GameSnapshot sharedSnapshot;
+
+// Caminho de volta: quando a última pergunta nova chegou ao painel
+static volatile uint32_t shownQuestionId = 0;
+static volatile uint32_t shownQuestionUs = 0;
+
+void publishGameSnapshot(const GameSnapshot *snapshot)
+{
+  snapshotSeq++;
+  __dmb();
+  memcpy(&sharedSnapshot, snapshot, sizeof(sharedSnapshot));
+  __dmb();
+  snapshotSeq++;
+  __sev(); // Acorda o core 1 se ele estiver esperando em __wfe()
+}
+
+uint32_t readGameSnapshot(GameSnapshot *out)
+{
+  uint32_t seq;
+
+  do
+  {
+    // Espera qualquer escrita em andamento terminar
+    while ((seq = snapshotSeq) & 1u)
+      tight_loop_contents();
+
+    __dmb();
+    memcpy(out, &sharedSnapshot, sizeof(*out));
+    __dmb();
+  } while (snapshotSeq != seq); // Houve escrita durante a cópia: tenta de novo
+
+  return seq;
+}
+
+void __not_in_flash_func(publishQuestionShown)(uint32_t questionId, uint32_t shownUs)
+{
+  shownQuestionUs = shownUs;
+  __dmb(); // O tempo fica visível antes do id que o valida
+  shownQuestionId = questionId;
+}
+
+bool readQuestionShown(uint32_t questionId, uint32_t *shownUs)
+{
+  if (shownQuestionId != questionId)
+    return false;
+  __dmb();
+  *shownUs = shownQuestionUs;
+  return true;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file game_snapshot.h
+ * @brief Game state shared between the logic core and the render core.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Core 0 runs the state machine and publishes an immutable copy of everything
+ * the screen and LEDs depend on. Core 1 reads the latest copy every frame.
+ * The shared copy is protected by a seqlock: the single writer never waits,
+ * and a reader that overlaps a write simply retries.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef GAME_SNAPSHOT_H
+#define GAME_SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pico/time.h"
+#include "numtext.h"
+#include "player.h"
+#include "speed_round.h"
+
+// Máquina de estados para controlar o fluxo do jogo
+typedef enum
+{
+  GENERATE_NEW_QUESTION,
+  WAITING_FOR_INPUT,
+  CHECK_ANSWER,
+  SHOWING_RESULT,
+  SHOWING_LEADERBOARD, // Fim da rodada cronometrada
+  GAME_STATE_COUNT
+} GameState;
+
+// Modos de energia, decididos pelo core 0 (ver power.h)
+typedef enum
+{
+  POWER_ACTIVE,  // Jogo normal
+  POWER_ATTRACT, // Sem teclas há algum tempo: tela de espera com brilho reduzido
+  POWER_SLEEP    // Painel e LEDs desligados, CPU dormindo até uma tecla
+} PowerMode;
+
+/**
+ * @brief Everything the render core needs to draw a frame.
+ */
+typedef struct
+{
+  GameState state;
+  uint32_t questionId;             // Muda a cada nova questão (reinicia a animação)
+  char questionStr[16];            // "num1 + num2 = ?" (ou -, x)
+  uint8_t questionLen;             // Caracteres de questionStr
+  NumberInput answer;              // Resposta digitada até agora (do jogador da vez)
+  int correctAnswer;               // Mostrada na tela de erro
+  bool lastAnswerCorrect;          // Resultado da última verificação
+  uint16_t streak;                 // Acertos seguidos
+  uint16_t bestStreak;             // Recorde de acertos seguidos (salvo na flash)
+  absolute_time_t answerHintUntil; // Até quando mostrar "Digite a resposta"
+  PowerMode powerMode;             // O desenho acompanha o modo de energia
+  bool speedRound;                 // Rodada cronometrada em andamento
+  absolute_time_t roundEndsAt;     // Fim da rodada (barra de tempo no topo)
+  SpeedScore roundScore;           // Placar da rodada atual ou da última
+  SpeedLeaderboard leaderboard;    // Melhores rodadas da sessão
+  int8_t leaderboardRank;          // Posição da última rodada, -1 fora do placar
+  uint8_t playerCount;             // Jogadores se revezando (1 = jogo solo)
+  uint8_t activePlayer;            // De quem é a pergunta atual (0 a playerCount - 1)
+  PlayerScore players[MAX_PLAYERS];
+} GameSnapshot;
+
+/**
+ * @brief Publishes a new snapshot. Only one core may call this.
+ * Also signals an event, waking a reader parked in __wfe().
+ */
+void publishGameSnapshot(const GameSnapshot *snapshot);
+
+/**
+ * @brief Copies the latest consistent snapshot.
+ * @return Sequence number of the copy, which changes on every publish
+ */
+uint32_t readGameSnapshot(GameSnapshot *out);
+
+/**
+ * @brief Records when the first frame showing a question reached the panel.
+ * The way back from the render side to the game; safe from an interrupt.
+ * @param shownUs time_us_32() at the end of the flush
+ */
+void publishQuestionShown(uint32_t questionId, uint32_t shownUs);
+
+/**
+ * @brief Gets the time published for questionId.
+ * @return false if that question has not reached the panel yet
+ */
+bool readQuestionShown(uint32_t questionId, uint32_t *shownUs);
+
+#endif // GAME_SNAPSHOT_H
@@ -0,0 +1,22 @@
+/**
+ * @file buzzer.h
+ * @brief Host stand-in for the patroLibs buzzer driver.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The game only plays sounds through tone_sequencer.h, whose host backend
+ * records the notes instead of driving a PWM pin.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef BUZZER_H
+#define BUZZER_H
+
+#include <stdint.h>
+
+void initBuzzerPWM(void);
+void playTone(uint32_t frequency, uint32_t duration_ms);
+void playWelcomeTones(void);
+
+#endif // BUZZER_H
@@ -0,0 +1,26 @@
+/**
+ * @file clocks.h
+ * @brief Host stand-in for hardware/clocks.h: a fixed 125 MHz system clock.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef HARDWARE_CLOCKS_H
+#define HARDWARE_CLOCKS_H
+
+#include <stdint.h>
+
+enum clock_index
+{
+  clk_sys = 5,
+};
+
+static inline uint32_t clock_get_hz(enum clock_index clk)
+{
+  (void)clk;
+  return 125000000u;
+}
+
+#endif // HARDWARE_CLOCKS_H
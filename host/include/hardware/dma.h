@@ -0,0 +1,88 @@
+/**
+ * @file dma.h
+ * @brief Host stand-in for the parts of hardware/dma.h used by audio.c.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * One channel is modelled: each simDmaStep() (one DMA timer pace) moves a
+ * sample from the read ring to the write register, and the end of the
+ * transfer count raises DMA_IRQ_0 as on the RP2040.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef HARDWARE_DMA_H
+#define HARDWARE_DMA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pico/stdlib.h"
+
+enum dma_channel_transfer_size
+{
+  DMA_SIZE_8 = 0,
+  DMA_SIZE_16 = 1,
+  DMA_SIZE_32 = 2,
+};
+
+typedef struct
+{
+  uint8_t size;
+  bool readIncrement;
+  bool writeIncrement;
+  uint8_t ringBits; // Wrap do endereço de leitura (0 = sem anel)
+  uint dreq;
+} dma_channel_config;
+
+int dma_claim_unused_channel(bool required);
+int dma_claim_unused_timer(bool required);
+void dma_timer_set_fraction(uint timer, uint16_t numerator, uint16_t denominator);
+
+static inline uint dma_get_timer_dreq(uint timer)
+{
+  return 0x3b + timer;
+}
+
+static inline dma_channel_config dma_channel_get_default_config(uint channel)
+{
+  (void)channel;
+  dma_channel_config c = {DMA_SIZE_32, true, false, 0, 0x3f};
+  return c;
+}
+
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size)
+{
+  c->size = (uint8_t)size;
+}
+
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool incr)
+{
+  c->readIncrement = incr;
+}
+
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool incr)
+{
+  c->writeIncrement = incr;
+}
+
+static inline void channel_config_set_ring(dma_channel_config *c, bool write, uint sizeBits)
+{
+  (void)write; // Só o anel de leitura é modelado
+  c->ringBits = (uint8_t)sizeBits;
+}
+
+static inline void channel_config_set_dreq(dma_channel_config *c, uint dreq)
+{
+  c->dreq = dreq;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *writeAddr,
+                           const volatile void *readAddr, uint transferCount, bool trigger);
+void dma_channel_set_read_addr(uint channel, const volatile void *readAddr, bool trigger);
+void dma_channel_set_trans_count(uint channel, uint32_t transferCount, bool trigger);
+void dma_channel_set_irq0_enabled(uint channel, bool enabled);
+bool dma_channel_get_irq0_status(uint channel);
+void dma_channel_acknowledge_irq0(uint channel);
+
+#endif // HARDWARE_DMA_H
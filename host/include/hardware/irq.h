@@ -0,0 +1,28 @@
+/**
+ * @file irq.h
+ * @brief Host stand-in for hardware/irq.h: one shared handler on DMA_IRQ_0.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The faked DMA calls the handler itself when a transfer count runs out,
+ * or on restore_interrupts() if it ran out while interrupts were disabled.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef HARDWARE_IRQ_H
+#define HARDWARE_IRQ_H
+
+#include <stdbool.h>
+
+#include "pico/stdlib.h"
+
+#define DMA_IRQ_0 11
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+
+typedef void (*irq_handler_t)(void);
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority);
+void irq_set_enabled(uint num, bool enabled);
+
+#endif // HARDWARE_IRQ_H
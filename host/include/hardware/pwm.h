@@ -0,0 +1,80 @@
+/**
+ * @file pwm.h
+ * @brief Host stand-in for the parts of hardware/pwm.h used by audio.c.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The slices are plain registers: the faked DMA writes the compare level
+ * and the audio harness reads it back as the output sample.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef HARDWARE_PWM_H
+#define HARDWARE_PWM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pico/stdlib.h"
+
+#define NUM_PWM_SLICES 8
+
+typedef struct
+{
+  volatile uint32_t cc;
+} pwm_slice_hw_t;
+
+typedef struct
+{
+  pwm_slice_hw_t slice[NUM_PWM_SLICES];
+} pwm_hw_t;
+
+extern pwm_hw_t simPwm;
+#define pwm_hw (&simPwm)
+
+typedef struct
+{
+  uint16_t top;
+} pwm_config;
+
+enum gpio_function
+{
+  GPIO_FUNC_PWM = 4,
+};
+
+static inline void gpio_set_function(uint gpio, enum gpio_function fn)
+{
+  (void)gpio;
+  (void)fn;
+}
+
+static inline uint pwm_gpio_to_slice_num(uint gpio)
+{
+  return (gpio >> 1) & 7u;
+}
+
+static inline pwm_config pwm_get_default_config(void)
+{
+  pwm_config c = {0xffff};
+  return c;
+}
+
+static inline void pwm_config_set_wrap(pwm_config *c, uint16_t wrap)
+{
+  c->top = wrap;
+}
+
+static inline void pwm_init(uint slice, pwm_config *c, bool start)
+{
+  (void)c;
+  (void)start;
+  pwm_hw->slice[slice].cc = 0;
+}
+
+static inline void pwm_set_gpio_level(uint gpio, uint16_t level)
+{
+  pwm_hw->slice[pwm_gpio_to_slice_num(gpio)].cc = level;
+}
+
+#endif // HARDWARE_PWM_H
@@ -0,0 +1,28 @@
+/**
+ * @file sync.h
+ * @brief Host stand-in for hardware/sync.h (barriers and event hints).
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef HARDWARE_SYNC_H
+#define HARDWARE_SYNC_H
+
+#include <stdint.h>
+
+static inline void __dmb(void)
+{
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+// Sem um segundo core para acordar, os avisos de evento não fazem nada
+static inline void __sev(void) {}
+static inline void __wfe(void) {}
+
+// Definidas pelo DMA simulado (sim_audio_hw.c): um IRQ pendente roda ao reabilitar
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
+
+#endif // HARDWARE_SYNC_H
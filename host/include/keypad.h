@@ -0,0 +1,29 @@
+/**
+ * @file keypad.h
+ * @brief Host stand-in for the patroLibs keypad driver.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The simulator feeds keypad_events.h directly (see sim.h), so the polled
+ * driver is only declared here to keep the shared headers compiling.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef KEYPAD_H
+#define KEYPAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct
+{
+  int row;
+  int col;
+  bool pressed;
+} KeyEvent;
+
+void initKeypad(void);
+KeyEvent keypadScan(void);
+
+#endif // KEYPAD_H
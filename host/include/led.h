@@ -0,0 +1,23 @@
+/**
+ * @file led.h
+ * @brief Host stand-in for the patroLibs RGB LED driver.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef LED_H
+#define LED_H
+
+#include <stdint.h>
+
+// Pinos do LED RGB da BitDogLab
+#define LED_RED_PIN 13
+#define LED_GREEN_PIN 11
+#define LED_BLUE_PIN 12
+
+void initLeds(void);
+void setLedBrightness(uint8_t pin, uint8_t level);
+
+#endif // LED_H
@@ -0,0 +1,33 @@
+/**
+ * @file stdlib.h
+ * @brief Host stand-in for the parts of pico/stdlib.h used by the game modules.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef PICO_STDLIB_H
+#define PICO_STDLIB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pico/time.h"
+
+typedef unsigned int uint;
+
+#ifndef count_of
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+#endif
+
+// No host não há flash/RAM separadas
+#define __not_in_flash_func(func_name) func_name
+#define __not_in_flash(group)
+
+static inline void tight_loop_contents(void) {}
+
+#endif // PICO_STDLIB_H
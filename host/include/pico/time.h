@@ -0,0 +1,88 @@
+/**
+ * @file time.h
+ * @brief Host stand-in for pico/time.h, backed by the simulator's virtual clock.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Time only moves when the simulator advances it (simAdvanceUs()) or when
+ * code sleeps, so a run is fully deterministic and as fast as the host allows.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef PICO_TIME_H
+#define PICO_TIME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef uint64_t absolute_time_t;
+
+#define nil_time ((absolute_time_t)0)
+
+uint64_t time_us_64(void);
+
+static inline uint32_t time_us_32(void)
+{
+  return (uint32_t)time_us_64();
+}
+
+static inline absolute_time_t get_absolute_time(void)
+{
+  return time_us_64();
+}
+
+static inline uint64_t to_us_since_boot(absolute_time_t t)
+{
+  return t;
+}
+
+static inline uint32_t to_ms_since_boot(absolute_time_t t)
+{
+  return (uint32_t)(t / 1000);
+}
+
+static inline absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us)
+{
+  return t + us;
+}
+
+static inline absolute_time_t delayed_by_ms(absolute_time_t t, uint32_t ms)
+{
+  return t + (uint64_t)ms * 1000;
+}
+
+static inline absolute_time_t make_timeout_time_us(uint64_t us)
+{
+  return delayed_by_us(get_absolute_time(), us);
+}
+
+static inline absolute_time_t make_timeout_time_ms(uint32_t ms)
+{
+  return delayed_by_ms(get_absolute_time(), ms);
+}
+
+static inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to)
+{
+  return (int64_t)(to - from);
+}
+
+static inline bool time_reached(absolute_time_t t)
+{
+  return get_absolute_time() >= t;
+}
+
+/** Avança o relógio virtual até @p t (não espera de verdade). */
+void sleep_until(absolute_time_t t);
+
+static inline void sleep_us(uint64_t us)
+{
+  sleep_until(make_timeout_time_us(us));
+}
+
+static inline void sleep_ms(uint32_t ms)
+{
+  sleep_until(make_timeout_time_ms(ms));
+}
+
+#endif // PICO_TIME_H
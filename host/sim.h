@@ -0,0 +1,84 @@
+/**
+ * @file sim.h
+ * @brief Controls for the host simulator backends (clock, keypad, sound, LEDs, display).
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The host build links the portable game modules (game, render, oled_draw,
+ * oled_text_cache, game_snapshot) against host implementations of oled.h,
+ * keypad_events.h, tone_sequencer.h and led_effects.h. The functions below
+ * let the simulator drive those backends and inspect what they did.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/** Imprime no stdout os sons e os efeitos de LED conforme acontecem. */
+extern bool simVerbose;
+
+// -- Relógio virtual
+
+/**
+ * @brief Moves the virtual clock forward.
+ */
+void simAdvanceUs(uint64_t us);
+
+// -- Teclado
+
+/**
+ * @brief Queues a key transition as if the scanner had just confirmed it.
+ * @return false if the event queue is full (counted as dropped)
+ */
+bool simPushKeyEvent(uint8_t row, uint8_t col, bool pressed);
+
+/**
+ * @brief Finds the matrix position of a key in keypad_key_map.
+ * @return false if the character is not on the keypad
+ */
+bool simFindKey(char key, uint8_t *row, uint8_t *col);
+
+// -- Buzzer
+
+/**
+ * @brief Number of notes handed to the tone sequencer since start-up.
+ */
+uint32_t simToneCount(void);
+
+/**
+ * @brief Frequency of the last note queued, in Hz (0 if none).
+ */
+uint16_t simLastToneFrequency(void);
+
+// -- LEDs
+
+/**
+ * @brief Level the current effect on @p pin settles on (peak level for a pulse).
+ */
+uint8_t simLedLevel(uint8_t pin);
+
+// -- Display
+
+/**
+ * @brief Prints what is on the panel as ASCII art (one character per pixel).
+ */
+void simDumpDisplay(FILE *out);
+
+/**
+ * @brief Writes what is on the panel as a binary PBM image.
+ * @return false if the file could not be written
+ */
+bool simWritePbm(const char *path);
+
+/**
+ * @brief Flushes that skipped a page which had changed (left out of the page mask).
+ * Always 0 unless the dirty tracking of hud.c misses something.
+ */
+uint32_t simOledMaskMisses(void);
+
+#endif // SIM_H
@@ -0,0 +1,136 @@
+/**
+ * @file sim_audio.c
+ * @brief Host harness for audio.c: runs the mixer against faked DMA and PWM.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ *   PatroSumAudioSim              runs every check, exits non-zero on failure
+ *
+ * One simDmaStep() is one sample at AUDIO_SAMPLE_RATE. The checks cover a
+ * tone that starts and stops the stream on its own, and a second tone
+ * started at every sample of the first one's stream, including the block
+ * where the interrupt has already mixed the silence that ends it.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "audio.h"
+#include "board.h"
+#include "sim_audio_hw.h"
+
+#include "hardware/pwm.h"
+
+/** Limite de amostras para o fluxo parar sozinho (2 s). */
+#define MAX_STREAM_SAMPLES (2 * AUDIO_SAMPLE_RATE)
+
+/** Amplitude mínima (pico a pico) para considerar que uma nota foi ouvida. */
+#define MIN_HEARD_SWING 100
+
+typedef struct
+{
+  uint32_t samples; // Amostras tocadas até o fluxo parar
+  uint16_t minLevel;
+  uint16_t maxLevel;
+  uint16_t lastLevel;
+} Played;
+
+static int failures = 0;
+
+static void check(bool ok, const char *what, long offset)
+{
+  if (ok)
+    return;
+  failures++;
+  if (offset >= 0)
+    fprintf(stderr, "FALHOU: %s (segunda nota na amostra %ld)\n", what, offset);
+  else
+    fprintf(stderr, "FALHOU: %s\n", what);
+}
+
+static uint16_t level(void)
+{
+  return simPwmLevel(pwm_gpio_to_slice_num(BUZZER_PIN));
+}
+
+/**
+ * @brief Steps the DMA until the stream stops by itself, recording the output.
+ */
+static Played runUntilIdle(void)
+{
+  Played p = {0, UINT16_MAX, 0, 0};
+  while (audioIsActive() && p.samples < MAX_STREAM_SAMPLES)
+  {
+    simDmaStep();
+    uint16_t l = level();
+    p.minLevel = l < p.minLevel ? l : p.minLevel;
+    p.maxLevel = l > p.maxLevel ? l : p.maxLevel;
+    p.lastLevel = l;
+    p.samples++;
+  }
+  return p;
+}
+
+static uint32_t samplesFor(uint16_t ms)
+{
+  return (uint32_t)ms * AUDIO_SAMPLE_RATE / 1000;
+}
+
+/**
+ * @brief A lone tone plays for its duration, then the stream stops at rest.
+ */
+static void checkSingleTone(void)
+{
+  audioTone(AUDIO_VOICE_MUSIC, 440, 50, AUDIO_DEFAULT_VOLUME);
+  Played p = runUntilIdle();
+
+  check(!audioIsActive(), "o fluxo não parou sozinho", -1);
+  check(!simDmaBusy(), "o DMA ficou ativo depois do fim", -1);
+  check(p.samples >= samplesFor(50), "a nota tocou menos que a sua duração", -1);
+  check(p.maxLevel - p.minLevel >= MIN_HEARD_SWING, "a nota não foi ouvida", -1);
+  check(p.lastLevel == 0, "o fluxo não terminou em repouso", -1);
+}
+
+/**
+ * @brief A second tone started at any sample of the first one's stream is heard in full.
+ */
+static void checkToneDuringStream(void)
+{
+  const uint16_t firstMs = 20;
+  const uint16_t secondMs = 100;
+
+  for (long offset = 0;; offset++)
+  {
+    audioTone(AUDIO_VOICE_EFFECT, 880, firstMs, AUDIO_DEFAULT_VOLUME);
+    for (long i = 0; i < offset && audioIsActive(); i++)
+      simDmaStep();
+    if (!audioIsActive())
+      break; // Passou do fim do primeiro fluxo
+
+    audioTone(AUDIO_VOICE_MUSIC, 440, secondMs, AUDIO_DEFAULT_VOLUME);
+    Played p = runUntilIdle();
+
+    check(!audioIsActive(), "o fluxo não parou sozinho", offset);
+    check(p.samples >= samplesFor(secondMs), "a segunda nota foi cortada", offset);
+    check(p.maxLevel - p.minLevel >= MIN_HEARD_SWING, "a segunda nota não foi ouvida", offset);
+    check(p.lastLevel == 0, "o fluxo não terminou em repouso", offset);
+    if (failures)
+      return;
+  }
+}
+
+int main(void)
+{
+  initAudio();
+
+  checkSingleTone();
+  if (!failures)
+    checkToneDuringStream();
+
+  if (failures)
+    return 1;
+  printf("audio: ok\n");
+  return 0;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file sim_audio_hw.c
+ * @brief Faked PWM, DMA channel and DMA_IRQ_0 behind the host hardware headers.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Only what audio.c touches is modelled: a single channel that moves one
+ * 16-bit sample per step through a read ring into a PWM compare register,
+ * and the block-complete interrupt, which is held back while interrupts
+ * are disabled and runs as soon as they are restored.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "sim_audio_hw.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pwm.h"
+#include "hardware/sync.h"
+
+pwm_hw_t simPwm;
+
+static dma_channel_config channelCfg;
+static volatile uint32_t *writeReg = NULL;
+static uintptr_t readAddr = 0;
+static uint32_t transCount = 0;
+static bool busy = false;
+static bool irqEnabled = false;  // INTE0 do canal
+static bool irqStatus = false;   // INTS0 do canal
+static bool nvicEnabled = false; // DMA_IRQ_0 no NVIC
+static bool interruptsOff = false;
+static bool inHandler = false;
+static irq_handler_t handler = NULL;
+static bool claimed = false;
+
+static void fail(const char *what)
+{
+  fprintf(stderr, "DMA simulado: %s\n", what);
+  exit(2);
+}
+
+/**
+ * @brief Runs the handler if the interrupt is pending and can be taken now.
+ */
+static void serviceIrq(void)
+{
+  while (irqStatus && irqEnabled && nvicEnabled && handler && !interruptsOff && !inHandler)
+  {
+    inHandler = true;
+    interruptsOff = true; // Sem aninhamento: o handler roda com a mesma prioridade
+    handler();
+    interruptsOff = false;
+    inHandler = false;
+    if (irqStatus)
+      fail("o handler não reconheceu o IRQ");
+  }
+}
+
+uint32_t save_and_disable_interrupts(void)
+{
+  uint32_t was = interruptsOff ? 1u : 0u;
+  interruptsOff = true;
+  return was;
+}
+
+void restore_interrupts(uint32_t status)
+{
+  interruptsOff = status != 0;
+  serviceIrq();
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t fn, uint8_t order_priority)
+{
+  (void)order_priority;
+  if (num != DMA_IRQ_0 || handler)
+    fail("só um handler em DMA_IRQ_0 é modelado");
+  handler = fn;
+}
+
+void irq_set_enabled(uint num, bool enabled)
+{
+  if (num == DMA_IRQ_0)
+    nvicEnabled = enabled;
+}
+
+int dma_claim_unused_channel(bool required)
+{
+  (void)required;
+  if (claimed)
+    fail("só um canal é modelado");
+  claimed = true;
+  return 0;
+}
+
+int dma_claim_unused_timer(bool required)
+{
+  (void)required;
+  return 0;
+}
+
+void dma_timer_set_fraction(uint timer, uint16_t numerator, uint16_t denominator)
+{
+  (void)timer;
+  (void)numerator;
+  (void)denominator; // A harness chama simDmaStep() no ritmo de uma amostra
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write,
+                           const volatile void *read, uint count, bool trigger)
+{
+  (void)channel;
+  channelCfg = *config;
+  if (channelCfg.size != DMA_SIZE_16 || channelCfg.writeIncrement)
+    fail("configuração não modelada");
+  writeReg = (volatile uint32_t *)write;
+  readAddr = (uintptr_t)read;
+  transCount = count;
+  busy = trigger && count;
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read, bool trigger)
+{
+  (void)channel;
+  if (busy)
+    fail("endereço de leitura trocado com o canal ocupado");
+  readAddr = (uintptr_t)read;
+  busy = trigger && transCount;
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t count, bool trigger)
+{
+  (void)channel;
+  if (busy)
+    fail("contagem trocada com o canal ocupado");
+  transCount = count;
+  busy = trigger && count;
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled)
+{
+  (void)channel;
+  irqEnabled = enabled;
+}
+
+bool dma_channel_get_irq0_status(uint channel)
+{
+  (void)channel;
+  return irqStatus;
+}
+
+void dma_channel_acknowledge_irq0(uint channel)
+{
+  (void)channel;
+  irqStatus = false;
+}
+
+void simDmaStep(void)
+{
+  if (busy)
+  {
+    *writeReg = *(const uint16_t *)readAddr;
+
+    uintptr_t next = readAddr + sizeof(uint16_t);
+    if (channelCfg.ringBits)
+    {
+      uintptr_t mask = ((uintptr_t)1 << channelCfg.ringBits) - 1;
+      next = (readAddr & ~mask) | (next & mask);
+    }
+    readAddr = next;
+
+    if (--transCount == 0)
+    {
+      busy = false;
+      irqStatus = true;
+    }
+  }
+  serviceIrq();
+}
+
+bool simDmaBusy(void)
+{
+  return busy;
+}
+
+uint16_t simPwmLevel(uint slice)
+{
+  return (uint16_t)simPwm.slice[slice].cc;
+}
@@ -0,0 +1,34 @@
+/**
+ * @file sim_audio_hw.h
+ * @brief Controls of the faked DMA and PWM used by the audio harness.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef SIM_AUDIO_HW_H
+#define SIM_AUDIO_HW_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief One DMA timer pace: moves a sample if the channel is busy and
+ * takes the block-complete interrupt when it is pending and allowed.
+ */
+void simDmaStep(void);
+
+/**
+ * @brief Whether the channel still has transfers to do.
+ */
+bool simDmaBusy(void);
+
+/**
+ * @brief Compare level last written to a PWM slice.
+ */
+uint16_t simPwmLevel(uint slice);
+
+#endif // SIM_AUDIO_HW_H
@@ -0,0 +1,30 @@
+/**
+ * @file sim_clock.c
+ * @brief Virtual clock behind the host pico/time.h.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "sim.h"
+
+#include "pico/time.h"
+
+static uint64_t nowUs = 0;
+
+uint64_t time_us_64(void)
+{
+  return nowUs;
+}
+
+void sleep_until(absolute_time_t t)
+{
+  if (t > nowUs)
+    nowUs = t; // Dormir só adianta o relógio
+}
+
+void simAdvanceUs(uint64_t us)
+{
+  nowUs += us;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file sim_keypad.c
+ * @brief Host backend for keypad_events.h: the event queue is filled by the simulator.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "keypad_events.h"
+#include "game.h"
+#include "sim.h"
+
+#include "pico/time.h"
+
+static KeypadEvent eventQueue[KEYPAD_EVENT_QUEUE_SIZE];
+static uint32_t eventHead = 0;
+static uint32_t eventTail = 0;
+static uint32_t droppedEvents = 0;
+static uint32_t lastEventUs = 0;
+
+void initKeypadEvents(void)
+{
+  eventHead = eventTail = 0;
+  droppedEvents = 0;
+  lastEventUs = time_us_32();
+}
+
+bool simPushKeyEvent(uint8_t row, uint8_t col, bool pressed)
+{
+  if (eventHead - eventTail >= KEYPAD_EVENT_QUEUE_SIZE)
+  {
+    droppedEvents++;
+    return false;
+  }
+
+  KeypadEvent *evt = &eventQueue[eventHead % KEYPAD_EVENT_QUEUE_SIZE];
+  evt->row = row;
+  evt->col = col;
+  evt->pressed = pressed;
+  evt->timestamp_us = time_us_32();
+  eventHead++;
+  lastEventUs = evt->timestamp_us;
+  return true;
+}
+
+bool simFindKey(char key, uint8_t *row, uint8_t *col)
+{
+  for (uint8_t r = 0; r < KEYPAD_ROWS; r++)
+  {
+    for (uint8_t c = 0; c < KEYPAD_COLS; c++)
+    {
+      if (keypad_key_map[r][c] == key)
+      {
+        *row = r;
+        *col = c;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool keypadPollEvent(KeypadEvent *evt)
+{
+  if (eventTail == eventHead)
+    return false;
+
+  *evt = eventQueue[eventTail % KEYPAD_EVENT_QUEUE_SIZE];
+  eventTail++;
+  return true;
+}
+
+void keypadFlushEvents(void)
+{
+  eventTail = eventHead;
+}
+
+uint32_t keypadDroppedEvents(void)
+{
+  return droppedEvents;
+}
+
+uint32_t keypadLastEventUs(void)
+{
+  return lastEventUs;
+}
+
+void keypadSuspend(void)
+{
+}
+
+bool keypadWakePending(void)
+{
+  return eventTail != eventHead; // Qualquer tecla roteirizada acorda
+}
+
+void keypadResume(void)
+{
+}
+
+bool keypadUsingPio(void)
+{
+  return false;
+}
+
+uint32_t keypadScanPeriodUs(void)
+{
+  return KEYPAD_SCAN_PERIOD_US;
+}
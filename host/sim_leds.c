@@ -0,0 +1,82 @@
+/**
+ * @file sim_leds.c
+ * @brief Host backend for led_effects.h: records the effect requested for each LED.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "led_effects.h"
+#include "sim.h"
+
+#include "pico/time.h"
+
+static const uint8_t ledPins[] = {LED_RED_PIN, LED_GREEN_PIN, LED_BLUE_PIN};
+static const char *const ledNames[] = {"vermelho", "verde", "azul"};
+static uint8_t ledLevels[3];
+
+static void setEffect(uint8_t pin, const char *effect, uint8_t level)
+{
+  for (int i = 0; i < 3; i++)
+  {
+    if (ledPins[i] != pin)
+      continue;
+
+    ledLevels[i] = level;
+    if (simVerbose)
+      printf("[%8.3f s] LED %s: %s %u\n", time_us_64() / 1e6, ledNames[i], effect, level);
+  }
+}
+
+void initLedEffects(void)
+{
+  for (int i = 0; i < 3; i++)
+    ledLevels[i] = 0;
+}
+
+void ledSolid(uint8_t pin, uint8_t level)
+{
+  setEffect(pin, "fixo", level);
+}
+
+void ledPulse(uint8_t pin, uint8_t maxLevel, uint16_t periodMs)
+{
+  (void)periodMs;
+  setEffect(pin, "respiracao ate", maxLevel);
+}
+
+void ledBlink(uint8_t pin, uint8_t level, uint16_t halfPeriodMs, uint8_t times, uint8_t levelAfter)
+{
+  (void)level;
+  (void)halfPeriodMs;
+  (void)times;
+  setEffect(pin, "pisca e fica em", levelAfter);
+}
+
+void ledFade(uint8_t pin, uint8_t level, uint16_t durationMs, Easing easing)
+{
+  (void)durationMs;
+  (void)easing;
+  setEffect(pin, "transicao para", level);
+}
+
+void ledEffectsSuspend(void)
+{
+  for (int i = 0; i < 3; i++)
+    setEffect(ledPins[i], "fixo", 0);
+}
+
+void ledEffectsResume(void)
+{
+}
+
+uint8_t simLedLevel(uint8_t pin)
+{
+  for (int i = 0; i < 3; i++)
+  {
+    if (ledPins[i] == pin)
+      return ledLevels[i];
+  }
+  return 0;
+}
@@ -0,0 +1,494 @@
+/**
+ * @file sim_main.c
+ * @brief PatroSum host simulator: scripted sessions, fuzzing and throughput runs.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Runs the real game state machine and render pipeline on the host, one
+ * logic iteration per step of the virtual clock (1 / PATROSUM_LOGIC_HZ):
+ *
+ *   PatroSumSim [-v] script.txt   plays a script (stdin if omitted)
+ *   PatroSumSim --fuzz N [seed]   N steps of random keys, checking invariants
+ *   PatroSumSim --bench N         N bot-played steps, with and without rendering
+ *   PatroSumSim --rects N [seed]  N random fills, span path against the per-pixel one
+ *
+ * Script commands, one per line ('#' starts a comment):
+ *   type <keys>                   presses and releases each key, one per step
+ *   answer | wrong                types the correct (or a wrong) answer and 'A'
+ *   round                         presses '#' (starts or abandons a timed round)
+ *   players <n>                   holds '*' and presses n (hot-seat with n players)
+ *   wait <ms>                     lets the game run for a while
+ *   expect waiting|correct|wrong  fails the run if the game is elsewhere
+ *   expect speed|leaderboard      ... in a timed round, or on its leaderboard
+ *   expect op+|op-|opx            fails the run if the question has another operation
+ *   expect player<n>              fails the run if it is not player n's turn
+ *   dump                          prints the panel as ASCII art
+ *   pbm <file>                    writes the panel as a PBM image
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+#include "game.h"
+#include "game_snapshot.h"
+#include "keypad_events.h"
+#include "tone_sequencer.h"
+#include "led_effects.h"
+#include "oled.h"
+#include "oled_draw.h"
+#include "render.h"
+
+#ifndef PATROSUM_LOGIC_HZ
+#define PATROSUM_LOGIC_HZ 100
+#endif
+
+#define STEP_US (1000000u / PATROSUM_LOGIC_HZ)
+
+bool simVerbose = false;
+
+static GameSnapshot snapshot;
+
+/**
+ * @brief One iteration of the firmware loop (single-core build).
+ */
+static void step(bool render)
+{
+  gameUpdate();
+  gameFillSnapshot(&snapshot);
+  if (render)
+    renderFrame(&snapshot, STEP_US);
+  simAdvanceUs(STEP_US);
+}
+
+static void startGame(unsigned seed)
+{
+  initToneSequencer();
+  initKeypadEvents();
+  oledInit();
+  initLedEffects();
+  gameInit(seed);
+  gameFillSnapshot(&snapshot);
+}
+
+static bool pushKey(char key)
+{
+  uint8_t row, col;
+  if (!simFindKey(key, &row, &col))
+    return false;
+  return simPushKeyEvent(row, col, true) && simPushKeyEvent(row, col, false);
+}
+
+/**
+ * @brief Presses key while '*' is held down.
+ */
+static bool pushChord(char key)
+{
+  uint8_t row, col, clearRow, clearCol;
+  if (!simFindKey(key, &row, &col) || !simFindKey('*', &clearRow, &clearCol))
+    return false;
+  return simPushKeyEvent(clearRow, clearCol, true) && pushKey(key) && simPushKeyEvent(clearRow, clearCol, false);
+}
+
+static void typeKeys(const char *keys)
+{
+  for (const char *k = keys; *k; k++)
+  {
+    if (!pushKey(*k))
+      fprintf(stderr, "tecla desconhecida: '%c'\n", *k);
+    step(true);
+  }
+}
+
+// -- Roteiro
+
+static bool runScript(FILE *in)
+{
+  char line[128];
+  int lineNo = 0;
+
+  // Deixa a primeira pergunta aparecer
+  step(true);
+  step(true);
+
+  while (fgets(line, sizeof(line), in))
+  {
+    lineNo++;
+    char *comment = strchr(line, '#');
+    if (comment)
+      *comment = '\0';
+
+    char cmd[16], arg[96] = "";
+    if (sscanf(line, "%15s %95s", cmd, arg) < 1)
+      continue;
+
+    if (strcmp(cmd, "type") == 0)
+    {
+      typeKeys(arg);
+    }
+    else if (strcmp(cmd, "round") == 0)
+    {
+      typeKeys("#"); // '#' abre comentário no roteiro
+    }
+    else if (strcmp(cmd, "players") == 0)
+    {
+      if (!pushChord(arg[0]))
+        fprintf(stderr, "linha %d: tecla desconhecida: '%c'\n", lineNo, arg[0]);
+      step(true);
+    }
+    else if (strcmp(cmd, "answer") == 0 || strcmp(cmd, "wrong") == 0)
+    {
+      int value = snapshot.correctAnswer + (cmd[0] == 'w' ? 1 : 0);
+      char keys[16];
+      snprintf(keys, sizeof(keys), "%dA", value);
+      typeKeys(keys);
+      step(true); // CHECK_ANSWER -> SHOWING_RESULT
+    }
+    else if (strcmp(cmd, "wait") == 0)
+    {
+      for (long waited = 0; waited < atol(arg) * 1000; waited += STEP_US)
+        step(true);
+    }
+    else if (strcmp(cmd, "expect") == 0)
+    {
+      bool ok;
+      if (strcmp(arg, "waiting") == 0)
+        ok = snapshot.state == WAITING_FOR_INPUT;
+      else if (strcmp(arg, "correct") == 0)
+        ok = snapshot.state == SHOWING_RESULT && snapshot.lastAnswerCorrect;
+      else if (strcmp(arg, "wrong") == 0)
+        ok = snapshot.state == SHOWING_RESULT && !snapshot.lastAnswerCorrect;
+      else if (strcmp(arg, "speed") == 0)
+        ok = snapshot.speedRound;
+      else if (strcmp(arg, "leaderboard") == 0)
+        ok = snapshot.state == SHOWING_LEADERBOARD;
+      else if (strncmp(arg, "player", 6) == 0 && arg[6] != '\0') // player1..4: de quem é a vez
+        ok = snapshot.activePlayer + 1 == atoi(arg + 6);
+      else if (strncmp(arg, "op", 2) == 0 && arg[2] != '\0') // op+, op-, opx: operação da pergunta
+        ok = strchr(snapshot.questionStr, ' ') && strchr(snapshot.questionStr, ' ')[1] == arg[2];
+      else
+        ok = false;
+
+      if (!ok)
+      {
+        fprintf(stderr, "linha %d: esperado '%s', estado %d\n", lineNo, arg, snapshot.state);
+        simDumpDisplay(stderr);
+        return false;
+      }
+    }
+    else if (strcmp(cmd, "dump") == 0)
+    {
+      simDumpDisplay(stdout);
+    }
+    else if (strcmp(cmd, "pbm") == 0)
+    {
+      if (!simWritePbm(arg))
+        fprintf(stderr, "linha %d: não foi possível gravar %s\n", lineNo, arg);
+    }
+    else
+    {
+      fprintf(stderr, "linha %d: comando desconhecido '%s'\n", lineNo, cmd);
+      return false;
+    }
+  }
+
+  if (simOledMaskMisses())
+  {
+    fprintf(stderr, "%lu paginas alteradas ficaram fora da mascara de envio\n", (unsigned long)simOledMaskMisses());
+    return false;
+  }
+
+  const OledStats *stats = oledGetStats();
+  printf("%lu quadros (%lu sem mudancas), %lu janelas, %lu paginas, %lu bytes, %lu notas\n",
+         (unsigned long)stats->frames, (unsigned long)stats->framesSkipped, (unsigned long)stats->windowsSent,
+         (unsigned long)stats->pagesSent, (unsigned long)stats->bytesSent,
+         (unsigned long)simToneCount());
+  return true;
+}
+
+// -- Fuzzing
+
+/**
+ * @brief Checks the snapshot against what the game promises.
+ * @return Description of the first broken invariant, or NULL
+ */
+static const char *checkInvariants(const GameSnapshot *s)
+{
+  if (s->state >= GAME_STATE_COUNT)
+    return "estado invalido";
+
+  const NumberInput *in = &s->answer;
+  if (in->digits > NUMBER_INPUT_MAX_DIGITS || strnlen(in->text, sizeof(in->text)) != in->digits)
+    return "resposta com tamanho inconsistente";
+  for (size_t i = 0; i < in->digits; i++)
+  {
+    if (in->text[i] < '0' || in->text[i] > '9')
+      return "resposta com caractere que nao e digito";
+  }
+  if (in->value != (in->digits ? atoi(in->text) : 0))
+    return "valor da resposta nao bate com o texto";
+  if (strlen(s->questionStr) != s->questionLen)
+    return "tamanho da pergunta inconsistente";
+
+  if (s->questionId == 0)
+    return NULL; // Ainda não há pergunta
+
+  int a, b;
+  char op;
+  if (sscanf(s->questionStr, "%d %c %d = ?", &a, &op, &b) != 3)
+    return "pergunta mal formatada";
+  if (a < 0 || a > 999 || b < 0 || b > 999)
+    return "operando fora da faixa";
+  int expected = op == '+' ? a + b : op == '-' ? a - b : op == 'x' ? a * b : -1;
+  if (expected < 0 || expected != s->correctAnswer)
+    return "pergunta nao bate com a resposta correta";
+
+  if (s->state == SHOWING_RESULT && s->lastAnswerCorrect != (in->value == s->correctAnswer))
+    return "resultado nao bate com a resposta digitada";
+
+  const SpeedLeaderboard *board = &s->leaderboard;
+  if (board->count > SPEED_LEADERBOARD_SIZE)
+    return "placar com posicoes demais";
+  for (int i = 1; i < board->count; i++)
+  {
+    if (speedScoreBetter(&board->entries[i], &board->entries[i - 1]))
+      return "placar fora de ordem";
+  }
+  if (s->roundScore.correct > s->roundScore.answered)
+    return "rodada com mais acertos que respostas";
+
+  if (s->playerCount < 1 || s->playerCount > MAX_PLAYERS || s->activePlayer >= s->playerCount)
+    return "jogador da vez fora da faixa";
+  if (s->playerCount > 1 && s->speedRound)
+    return "rodada cronometrada com varios jogadores";
+  for (int p = 0; p < MAX_PLAYERS; p++)
+  {
+    if (s->players[p].correct > s->players[p].answered || s->players[p].streak > s->players[p].correct)
+      return "placar de jogador inconsistente";
+    if (p >= s->playerCount && s->players[p].answered)
+      return "jogador fora da partida com respostas";
+  }
+
+  return NULL;
+}
+
+static bool runFuzz(unsigned long steps, unsigned seed)
+{
+  static const char keys[] = "0123456789ABCD*#";
+  unsigned fuzzState = seed * 2654435761u + 1;
+
+  for (unsigned long i = 0; i < steps; i++)
+  {
+    // Gerador próprio, independente do sorteio das perguntas
+    fuzzState = fuzzState * 1103515245u + 12345u;
+    unsigned r = fuzzState >> 16;
+    if (r % 4 == 0)
+      pushKey(keys[(r >> 4) % (sizeof(keys) - 1)]);
+    else if (r % 512 == 1)
+      pushChord((char)('1' + (r >> 9) % MAX_PLAYERS)); // Troca o número de jogadores
+
+    step(true);
+
+    const char *broken = checkInvariants(&snapshot);
+    if (!broken && simOledMaskMisses())
+      broken = "pagina alterada fora da mascara de envio";
+    if (broken)
+    {
+      fprintf(stderr, "passo %lu (semente %u): %s\n", i, seed, broken);
+      fprintf(stderr, "pergunta '%s', resposta '%s', correta %d\n",
+              snapshot.questionStr, snapshot.answer.text, snapshot.correctAnswer);
+      simDumpDisplay(stderr);
+      return false;
+    }
+  }
+
+  printf("fuzz: %lu passos, %lu perguntas, %lu eventos descartados, sem falhas\n",
+         steps, (unsigned long)snapshot.questionId, (unsigned long)keypadDroppedEvents());
+  return true;
+}
+
+// -- Retângulos
+
+/**
+ * @brief Fills random rectangles, clipped ones and empty ones included, over
+ * random framebuffer contents, and compares the span path of oledFillRect()
+ * with the per-pixel reference byte for byte.
+ */
+static bool runRectCheck(unsigned long count, unsigned seed)
+{
+  static uint8_t start[OLED_PAGES][OLED_WIDTH];
+  static uint8_t spans[OLED_PAGES][OLED_WIDTH];
+  unsigned rectState = seed * 2654435761u + 1;
+
+  for (unsigned long i = 0; i < count; i++)
+  {
+    for (int page = 0; page < OLED_PAGES; page++)
+    {
+      for (int x = 0; x < OLED_WIDTH; x++)
+      {
+        rectState = rectState * 1103515245u + 12345u;
+        start[page][x] = (uint8_t)(rectState >> 16);
+      }
+    }
+
+    // Coordenadas até 8 pixels fora da tela em cada lado
+    int coords[4];
+    for (int c = 0; c < 4; c++)
+    {
+      rectState = rectState * 1103515245u + 12345u;
+      int limit = (c % 2 ? OLED_HEIGHT : OLED_WIDTH) + 16;
+      coords[c] = (int)((rectState >> 16) % (unsigned)limit) - 8;
+    }
+    bool on = (rectState >> 8) & 1;
+
+    memcpy(oledBuffer, start, sizeof(start));
+    oledFillRect(coords[0], coords[1], coords[2], coords[3], on);
+    memcpy(spans, oledBuffer, sizeof(spans));
+
+    memcpy(oledBuffer, start, sizeof(start));
+    if (on)
+    {
+      oledDrawRectanglePixels(coords[0], coords[1], coords[2], coords[3]);
+    }
+    else
+    {
+      for (int y = coords[1]; y < coords[3]; y++)
+      {
+        for (int x = coords[0]; x < coords[2]; x++)
+          oledSetPixel(x, y, false);
+      }
+    }
+
+    if (memcmp(spans, oledBuffer, sizeof(spans)) != 0)
+    {
+      fprintf(stderr, "retangulo %lu (semente %u): (%d, %d)-(%d, %d) %s difere da referencia\n",
+              i, seed, coords[0], coords[1], coords[2], coords[3], on ? "aceso" : "apagado");
+      return false;
+    }
+  }
+
+  printf("retangulos: %lu preenchimentos iguais a referencia\n", count);
+  return true;
+}
+
+// -- Vazão
+
+static double wallSeconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Plays the game as fast as possible: answers every question as soon as
+ * it appears (one in four wrong) and skips the result screen.
+ */
+static void runBot(unsigned long steps, bool render)
+{
+  uint32_t answeredId = 0;
+  GameState lastState = snapshot.state;
+
+  double start = wallSeconds();
+  for (unsigned long i = 0; i < steps; i++)
+  {
+    if (snapshot.state == WAITING_FOR_INPUT && snapshot.questionId != answeredId)
+    {
+      answeredId = snapshot.questionId;
+      char keys[16];
+      snprintf(keys, sizeof(keys), "%dA", snapshot.correctAnswer + (answeredId % 4 == 0));
+      for (const char *k = keys; *k; k++)
+        pushKey(*k);
+    }
+    else if (snapshot.state == SHOWING_RESULT && lastState != SHOWING_RESULT)
+    {
+      pushKey('A');
+    }
+    lastState = snapshot.state;
+
+    step(render);
+  }
+  double elapsed = wallSeconds() - start;
+
+  printf("%-18s %10lu passos %8.3f s %12.0f passos/s %10lu perguntas\n",
+         render ? "logica + desenho" : "so logica", steps, elapsed, steps / elapsed,
+         (unsigned long)snapshot.questionId);
+}
+
+static void usage(const char *prog)
+{
+  fprintf(stderr, "uso: %s [-v] [roteiro]\n"
+                  "     %s --fuzz <passos> [semente]\n"
+                  "     %s --bench <passos>\n"
+                  "     %s --rects <quantidade> [semente]\n",
+          prog, prog, prog, prog);
+}
+
+int main(int argc, char **argv)
+{
+  int arg = 1;
+  if (arg < argc && strcmp(argv[arg], "-v") == 0)
+  {
+    simVerbose = true;
+    arg++;
+  }
+
+  if (arg < argc && strcmp(argv[arg], "--fuzz") == 0)
+  {
+    if (arg + 1 >= argc)
+    {
+      usage(argv[0]);
+      return 2;
+    }
+    unsigned seed = arg + 2 < argc ? (unsigned)strtoul(argv[arg + 2], NULL, 0) : 1;
+    startGame(seed);
+    return runFuzz(strtoul(argv[arg + 1], NULL, 0), seed) ? 0 : 1;
+  }
+
+  if (arg < argc && strcmp(argv[arg], "--rects") == 0)
+  {
+    if (arg + 1 >= argc)
+    {
+      usage(argv[0]);
+      return 2;
+    }
+    unsigned seed = arg + 2 < argc ? (unsigned)strtoul(argv[arg + 2], NULL, 0) : 1;
+    return runRectCheck(strtoul(argv[arg + 1], NULL, 0), seed) ? 0 : 1;
+  }
+
+  if (arg < argc && strcmp(argv[arg], "--bench") == 0)
+  {
+    if (arg + 1 >= argc)
+    {
+      usage(argv[0]);
+      return 2;
+    }
+    unsigned long steps = strtoul(argv[arg + 1], NULL, 0);
+    startGame(1);
+    runBot(steps, false);
+    startGame(1);
+    runBot(steps, true);
+    return 0;
+  }
+
+  FILE *in = stdin;
+  if (arg < argc)
+  {
+    in = fopen(argv[arg], "r");
+    if (!in)
+    {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+
+  startGame(1);
+  bool ok = runScript(in);
+  if (in != stdin)
+    fclose(in);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file sim_oled.c
+ * @brief In-memory SSD1306 backend for oled.h.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Keeps the same dirty page diff and window planning as the I2C driver, so
+ * OledStats reports the traffic the real panel would see, but a flush just
+ * copies the windows into an in-memory panel that can be dumped as text or PBM.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "oled.h"
+#include "oled_window.h"
+#include "sim.h"
+
+#include <string.h>
+
+uint8_t oledBuffer[OLED_PAGES][OLED_WIDTH] __attribute__((aligned(4)));
+
+// Conteúdo do "painel"
+static uint8_t panelBuffer[OLED_PAGES][OLED_WIDTH];
+static bool forceFullUpdate = true;
+static bool panelOn = true;
+static bool panelInverted = false;
+static OledStats stats;
+static uint32_t maskMisses = 0;
+
+#define SIM_WINDOW_COST 11 // O mesmo custo por janela do transporte I2C (oled_i2c.c)
+
+static void sendWindow(const OledWindow *w)
+{
+  size_t len = (size_t)(w->lastCol - w->firstCol) + 1;
+  for (uint8_t page = w->firstPage; page <= w->lastPage; page++)
+    memcpy(&panelBuffer[page][w->firstCol], &oledBuffer[page][w->firstCol], len);
+  stats.pagesSent += (uint32_t)(w->lastPage - w->firstPage) + 1;
+  stats.bytesSent += oledWindowBytes(w);
+  stats.windowsSent++;
+}
+
+void oledInit(void)
+{
+  memset(&stats, 0, sizeof(stats));
+  maskMisses = 0;
+  memset(panelBuffer, 0, sizeof(panelBuffer));
+  panelOn = true; // A sequência de inicialização liga o painel, sem inversão
+  panelInverted = false;
+  oledClear();
+  oledInvalidate();
+}
+
+void oledClear(void)
+{
+  memset(oledBuffer, 0, sizeof(oledBuffer));
+}
+
+void oledInvalidate(void)
+{
+  forceFullUpdate = true;
+}
+
+bool oledShowPagesAsync(uint8_t pageMask, OledFlushCallback onComplete)
+{
+  OledSpan spans[OLED_PAGES];
+  stats.frames++;
+
+  for (uint8_t page = 0; page < OLED_PAGES; page++)
+  {
+    const uint8_t *next = oledBuffer[page];
+    const uint8_t *prev = panelBuffer[page];
+    spans[page] = OLED_SPAN_NONE;
+
+    if (forceFullUpdate)
+    {
+      spans[page] = (OledSpan){0, OLED_WIDTH - 1};
+      continue;
+    }
+
+    if (memcmp(next, prev, OLED_WIDTH) == 0)
+      continue;
+
+    if (!(pageMask & (1u << page)))
+    {
+      maskMisses++; // O firmware nem compararia: a página ficaria errada no painel
+      continue;
+    }
+
+    uint8_t first = 0;
+    while (next[first] == prev[first])
+      first++;
+    uint8_t last = OLED_WIDTH - 1;
+    while (next[last] == prev[last])
+      last--;
+    spans[page] = (OledSpan){first, last};
+  }
+  forceFullUpdate = false;
+
+  OledWindow windows[OLED_PAGES];
+  uint8_t count = oledPlanWindows(spans, SIM_WINDOW_COST, false, windows);
+  for (uint8_t i = 0; i < count; i++)
+    sendWindow(&windows[i]);
+
+  if (count == 0)
+    stats.framesSkipped++;
+  if (onComplete)
+    onComplete(); // A "transferência" termina na hora
+  return true;
+}
+
+bool oledShowAsync(OledFlushCallback onComplete)
+{
+  return oledShowPagesAsync(OLED_ALL_PAGES, onComplete);
+}
+
+uint32_t simOledMaskMisses(void)
+{
+  return maskMisses;
+}
+
+bool oledBusy(void)
+{
+  return false;
+}
+
+void oledWaitIdle(void)
+{
+}
+
+void oledShow(void)
+{
+  oledShowAsync(NULL);
+}
+
+void oledSetContrast(uint8_t contrast)
+{
+  (void)contrast; // O dump mostra só os pixels
+}
+
+void oledSetPower(bool on)
+{
+  panelOn = on;
+}
+
+void oledSetInverted(bool inverted)
+{
+  panelInverted = inverted;
+}
+
+uint32_t oledSetBusClock(uint32_t hz)
+{
+  return hz;
+}
+
+uint32_t oledGetBusClock(void)
+{
+  return OLED_I2C_BAUDRATE;
+}
+
+const char *oledBusName(void)
+{
+  return "sim";
+}
+
+const OledStats *oledGetStats(void)
+{
+  return &stats;
+}
+
+static bool panelPixel(int x, int y)
+{
+  if (!panelOn)
+    return false; // Painel desligado: tudo apagado
+  bool lit = (panelBuffer[y / 8][x] >> (y % 8)) & 1u;
+  return lit != panelInverted;
+}
+
+void simDumpDisplay(FILE *out)
+{
+  fputc('+', out);
+  for (int x = 0; x < OLED_WIDTH; x++)
+    fputc('-', out);
+  fputs("+\n", out);
+
+  for (int y = 0; y < OLED_HEIGHT; y++)
+  {
+    fputc('|', out);
+    for (int x = 0; x < OLED_WIDTH; x++)
+      fputc(panelPixel(x, y) ? '#' : ' ', out);
+    fputs("|\n", out);
+  }
+
+  fputc('+', out);
+  for (int x = 0; x < OLED_WIDTH; x++)
+    fputc('-', out);
+  fputs("+\n", out);
+}
+
+bool simWritePbm(const char *path)
+{
+  FILE *f = fopen(path, "wb");
+  if (!f)
+    return false;
+
+  fprintf(f, "P4\n%d %d\n", OLED_WIDTH, OLED_HEIGHT);
+  for (int y = 0; y < OLED_HEIGHT; y++)
+  {
+    // P4: 8 pixels por byte, MSB à esquerda, 1 = preto
+    for (int x = 0; x < OLED_WIDTH; x += 8)
+    {
+      uint8_t bits = 0;
+      for (int b = 0; b < 8; b++)
+      {
+        if (!panelPixel(x + b, y))
+          bits |= 0x80u >> b;
+      }
+      fputc(bits, f);
+    }
+  }
+
+  return fclose(f) == 0;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file sim_stats.c
+ * @brief Host backend for stats_store.h: statistics live only in RAM.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Each run starts from zero, like a board with an empty log. The batching
+ * rule of the firmware is kept so the simulated saves happen at the same
+ * moments.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "stats_store.h"
+
+#include <string.h>
+
+#include "pico/time.h"
+
+static GameStats savedStats;
+static GameStats pendingStats;
+static bool pending = false;
+static absolute_time_t nextSaveAt;
+
+void statsStoreLoad(GameStats *out)
+{
+  memset(&savedStats, 0, sizeof(savedStats));
+  pending = false;
+  nextSaveAt = nil_time;
+  *out = savedStats;
+}
+
+void statsStoreSave(const GameStats *stats)
+{
+  pendingStats = *stats;
+  pending = true;
+}
+
+bool statsStorePoll(void)
+{
+  if (!pending || !time_reached(nextSaveAt))
+    return false;
+  statsStoreFlush();
+  nextSaveAt = make_timeout_time_ms(STATS_SAVE_INTERVAL_MS);
+  return true;
+}
+
+void statsStorePrepare(void)
+{
+  // Sem setores para apagar na memória simulada
+}
+
+void statsStoreFlush(void)
+{
+  savedStats = pendingStats;
+  pending = false;
+}
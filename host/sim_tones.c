@@ -0,0 +1,103 @@
+/**
+ * @file sim_tones.c
+ * @brief Host backend for tone_sequencer.h: notes are timed on the virtual clock and logged.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "tone_sequencer.h"
+#include "sim.h"
+
+#include "pico/time.h"
+
+// Fim de cada nota pendente, na ordem da fila (mesma capacidade do firmware)
+static uint64_t noteEnds[TONE_QUEUE_SIZE];
+static uint32_t noteHead = 0;
+static uint32_t noteTail = 0;
+
+static bool backgroundTones = false; // A fila atual cede ao próximo som
+static uint32_t toneCount = 0;
+static uint16_t lastFrequency = 0;
+
+static void dropFinishedNotes(void)
+{
+  uint64_t now = time_us_64();
+  while (noteTail != noteHead && noteEnds[noteTail % TONE_QUEUE_SIZE] <= now)
+    noteTail++;
+}
+
+void initToneSequencer(void)
+{
+  stopTones();
+}
+
+bool queueTones(const ToneNote *notes, size_t count)
+{
+  if (backgroundTones)
+    stopTones();
+  dropFinishedNotes();
+
+  for (size_t i = 0; i < count; i++)
+  {
+    if (noteHead - noteTail >= TONE_QUEUE_SIZE)
+      return false;
+
+    uint64_t start = noteHead != noteTail ? noteEnds[(noteHead - 1) % TONE_QUEUE_SIZE] : time_us_64();
+    uint64_t length = ((uint64_t)notes[i].duration_ms + notes[i].gap_ms) * 1000;
+    noteEnds[noteHead % TONE_QUEUE_SIZE] = start + length;
+    noteHead++;
+
+    toneCount++;
+    lastFrequency = notes[i].frequency;
+    if (simVerbose)
+      printf("[%8.3f s] buzzer %u Hz por %u ms\n", start / 1e6, notes[i].frequency, notes[i].duration_ms);
+  }
+  return true;
+}
+
+void playTones(const ToneNote *notes, size_t count)
+{
+  stopTones();
+  queueTones(notes, count);
+}
+
+void playBackgroundTones(const ToneNote *notes, size_t count)
+{
+  playTones(notes, count);
+  backgroundTones = true;
+}
+
+void queueTone(uint16_t frequency, uint16_t duration_ms)
+{
+  ToneNote note = {frequency, duration_ms, 0};
+  queueTones(&note, 1);
+}
+
+void playEffect(uint16_t frequency, uint16_t duration_ms)
+{
+  queueTone(frequency, duration_ms);
+}
+
+void stopTones(void)
+{
+  noteTail = noteHead;
+  backgroundTones = false;
+}
+
+bool isTonePlaying(void)
+{
+  dropFinishedNotes();
+  return noteTail != noteHead;
+}
+
+uint32_t simToneCount(void)
+{
+  return toneCount;
+}
+
+uint16_t simLastToneFrequency(void)
+{
+  return lastFrequency;
+}
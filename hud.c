@@ -0,0 +1,244 @@
+/**
+ * @file hud.c
+ * @brief Dirty tracking, layout and repaint of the retained widgets.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Widgets are OR-ed into the framebuffer, so erasing one can take pixels
+ * of a neighbour that overlaps it; those neighbours are redrawn in the same
+ * pass. Screens have a dozen widgets at most, so the overlap test is a
+ * plain double loop.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "hud.h"
+
+#include "pico/stdlib.h"
+#include "oled.h"
+#include "oled_draw.h"
+#include "oled_text_cache.h"
+#include "numtext.h"
+
+/**
+ * @brief Recomputes the left edge from the anchor, alignment and width.
+ */
+static void layout(HudWidget *w)
+{
+  int width = w->length * FONT_CHAR_ADVANCE;
+  if (w->align == HUD_ALIGN_CENTER)
+    w->left = (int16_t)(w->x - width / 2);
+  else if (w->align == HUD_ALIGN_RIGHT)
+    w->left = (int16_t)(w->x - width);
+  else
+    w->left = w->x;
+}
+
+static void initWidget(HudWidget *w, HudKind kind, HudAlign align, int x, int y)
+{
+  w->kind = kind;
+  w->align = align;
+  w->visible = true;
+  w->dirty = true;
+  w->shown = false;
+  w->x = (int16_t)x;
+  w->y = (int16_t)y;
+  w->x2 = 0;
+  w->y2 = 0;
+  w->length = 0;
+  w->prefixLength = 0;
+  w->value = 0;
+  w->label = NULL;
+  w->text[0] = '\0';
+  layout(w);
+}
+
+void hudInitLabel(HudWidget *w, HudAlign align, int x, int y, const char *text)
+{
+  initWidget(w, HUD_LABEL, align, x, y);
+  w->label = text;
+  w->length = (uint8_t)(oledTextWidth(text) / FONT_CHAR_ADVANCE);
+  layout(w);
+}
+
+void hudInitText(HudWidget *w, HudAlign align, int x, int y)
+{
+  initWidget(w, HUD_TEXT, align, x, y);
+}
+
+void hudInitNumber(HudWidget *w, HudAlign align, int x, int y, const char *prefix)
+{
+  initWidget(w, HUD_NUMBER, align, x, y);
+  uint8_t n = 0;
+  while (prefix[n] && n < HUD_TEXT_MAX - (FORMAT_NUMBER_SIZE - 1))
+  {
+    w->text[n] = prefix[n];
+    n++;
+  }
+  w->prefixLength = n;
+  w->length = (uint8_t)(n + formatNumber(&w->text[n], 0));
+  layout(w);
+}
+
+void hudInitBar(HudWidget *w, int x1, int y1, int x2, int y2)
+{
+  initWidget(w, HUD_BAR, HUD_ALIGN_LEFT, x1, y1);
+  w->x2 = (int16_t)x2;
+  w->y2 = (int16_t)y2;
+}
+
+void __not_in_flash_func(hudSetText)(HudWidget *w, const char *text, uint8_t length)
+{
+  if (length > HUD_TEXT_MAX)
+    length = HUD_TEXT_MAX;
+
+  bool same = length == w->length;
+  for (uint8_t i = 0; same && i < length; i++)
+    same = w->text[i] == text[i];
+  if (same)
+    return;
+
+  for (uint8_t i = 0; i < length; i++)
+    w->text[i] = text[i];
+  w->text[length] = '\0';
+  w->length = length;
+  layout(w);
+  w->dirty = true;
+}
+
+void __not_in_flash_func(hudSetNumber)(HudWidget *w, uint16_t value)
+{
+  if (value == w->value)
+    return;
+  w->value = value;
+  w->length = (uint8_t)(w->prefixLength + formatNumber(&w->text[w->prefixLength], value));
+  layout(w);
+  w->dirty = true;
+}
+
+void __not_in_flash_func(hudSetPosition)(HudWidget *w, int x, int y)
+{
+  if (x == w->x && y == w->y)
+    return;
+  w->x = (int16_t)x;
+  w->y = (int16_t)y;
+  layout(w);
+  w->dirty = true;
+}
+
+void __not_in_flash_func(hudSetBarWidth)(HudWidget *w, int width)
+{
+  if (w->x + width == w->x2)
+    return;
+  w->x2 = (int16_t)(w->x + width);
+  w->dirty = true;
+}
+
+void hudSetVisible(HudWidget *w, bool visible)
+{
+  if (visible == w->visible)
+    return;
+  w->visible = visible;
+  w->dirty = true;
+}
+
+void hudInvalidate(HudWidget *const *widgets, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    widgets[i]->shown = false;
+    widgets[i]->dirty = true;
+  }
+}
+
+/**
+ * @brief Area the widget covers with its current value and position.
+ */
+static HudRect __not_in_flash_func(widgetRect)(const HudWidget *w)
+{
+  HudRect r;
+  if (w->kind == HUD_BAR)
+  {
+    r.x1 = w->x;
+    r.y1 = w->y;
+    r.x2 = w->x2;
+    r.y2 = w->y2;
+  }
+  else
+  {
+    r.x1 = w->left;
+    r.y1 = w->y;
+    r.x2 = (int16_t)(w->left + w->length * FONT_CHAR_ADVANCE);
+    r.y2 = (int16_t)(w->y + FONT_GLYPH_HEIGHT);
+  }
+  return r;
+}
+
+static bool __not_in_flash_func(overlaps)(const HudRect *a, const HudRect *b)
+{
+  return a->x1 < b->x2 && b->x1 < a->x2 && a->y1 < b->y2 && b->y1 < a->y2;
+}
+
+/**
+ * @brief Pages covered by the rows of a rectangle, clipped to the panel.
+ */
+static uint8_t __not_in_flash_func(pageMaskOf)(const HudRect *r)
+{
+  int y1 = r->y1 < 0 ? 0 : r->y1;
+  int y2 = r->y2 > OLED_HEIGHT ? OLED_HEIGHT : r->y2;
+  if (y1 >= y2 || r->x1 >= OLED_WIDTH || r->x2 <= 0)
+    return 0;
+
+  uint8_t mask = 0;
+  for (int page = y1 / 8; page <= (y2 - 1) / 8; page++)
+    mask |= (uint8_t)(1u << page);
+  return mask;
+}
+
+uint8_t __not_in_flash_func(hudRender)(HudWidget *const *widgets, size_t count)
+{
+  uint8_t pages = 0;
+
+  // Apaga o que os widgets sujos deixaram; quem cruzava a área apagada é refeito
+  for (size_t i = 0; i < count; i++)
+  {
+    HudWidget *w = widgets[i];
+    if (!w->dirty || !w->shown)
+      continue;
+
+    oledFillRect(w->drawn.x1, w->drawn.y1, w->drawn.x2, w->drawn.y2, false);
+    pages |= pageMaskOf(&w->drawn);
+    w->shown = false;
+
+    for (size_t j = 0; j < count; j++)
+    {
+      HudWidget *other = widgets[j];
+      if (j != i && other->shown && overlaps(&other->drawn, &w->drawn))
+        other->dirty = true;
+    }
+  }
+
+  for (size_t i = 0; i < count; i++)
+  {
+    HudWidget *w = widgets[i];
+    if (!w->dirty)
+      continue;
+    w->dirty = false;
+    if (!w->visible)
+      continue;
+
+    HudRect r = widgetRect(w);
+    if (w->kind == HUD_BAR)
+      oledDrawRectangle(r.x1, r.y1, r.x2, r.y2);
+    else if (w->kind == HUD_LABEL)
+      oledDrawTextCached(w->left, w->y, w->label);
+    else
+      oledDrawText(w->left, w->y, w->text);
+
+    w->drawn = r;
+    w->shown = true;
+    pages |= pageMaskOf(&r);
+  }
+
+  return pages;
+}
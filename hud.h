@@ -0,0 +1,127 @@
+/**
+ * @file hud.h
+ * @brief Retained-mode widgets: labels, bound text and numbers, and bars.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * A screen is an array of widgets that stay in the framebuffer between
+ * frames. Setting a widget's text, number, position or visibility only
+ * marks it dirty when the value actually changes, and hudRender() then
+ * erases and redraws just the dirty widgets (and whatever they overlap).
+ * The layout of a text (its left edge, from its alignment and width) is
+ * computed when the text or the anchor changes, not every frame.
+ *
+ * hudRender() returns the pages it touched, for oledShowPagesAsync().
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef HUD_H
+#define HUD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Maior texto de um widget (uma linha inteira do display). */
+#define HUD_TEXT_MAX 21
+
+typedef enum
+{
+  HUD_LABEL,  // Texto fixo, servido pelo cache de textos
+  HUD_TEXT,   // Texto ligado a um valor (copiado para o widget)
+  HUD_NUMBER, // Prefixo fixo + número, formatado só quando o número muda
+  HUD_BAR     // Retângulo cheio
+} HudKind;
+
+typedef enum
+{
+  HUD_ALIGN_LEFT,   // x é a borda esquerda
+  HUD_ALIGN_CENTER, // x é o centro
+  HUD_ALIGN_RIGHT   // x é a borda direita
+} HudAlign;
+
+typedef struct
+{
+  int16_t x1, y1, x2, y2; // [x1, x2) x [y1, y2)
+} HudRect;
+
+typedef struct
+{
+  HudKind kind;
+  HudAlign align;
+  bool visible;
+  bool dirty;  // Redesenhar no próximo hudRender()
+  bool shown;  // Está no framebuffer, em `drawn`
+  int16_t x;   // Âncora horizontal (ou x1 da barra)
+  int16_t y;   // Topo do texto (ou y1 da barra)
+  int16_t x2;  // Barras: canto oposto
+  int16_t y2;
+  int16_t left; // Layout calculado: borda esquerda do texto
+  uint8_t length;
+  uint8_t prefixLength; // HUD_NUMBER: caracteres fixos antes do número
+  uint16_t value;       // HUD_NUMBER: número mostrado
+  const char *label;    // HUD_LABEL: texto (não copiado)
+  char text[HUD_TEXT_MAX + 1];
+  HudRect drawn; // Área ocupada no framebuffer, apagada antes de redesenhar
+} HudWidget;
+
+/**
+ * @brief Fixed text. `text` must outlive the widget (a literal).
+ */
+void hudInitLabel(HudWidget *w, HudAlign align, int x, int y, const char *text);
+
+/**
+ * @brief Text bound to a value through hudSetText(); starts empty.
+ */
+void hudInitText(HudWidget *w, HudAlign align, int x, int y);
+
+/**
+ * @brief Number after a fixed prefix ("Recorde: 12"); starts at 0.
+ */
+void hudInitNumber(HudWidget *w, HudAlign align, int x, int y, const char *prefix);
+
+/**
+ * @brief Filled rectangle [x1, x2) x [y1, y2).
+ */
+void hudInitBar(HudWidget *w, int x1, int y1, int x2, int y2);
+
+/**
+ * @brief Binds new text; dirty only if it differs from the current one.
+ * @param length Characters of text (known by the caller, no strlen)
+ */
+void hudSetText(HudWidget *w, const char *text, uint8_t length);
+
+/**
+ * @brief Binds a new number; formatted and dirty only if it changed.
+ */
+void hudSetNumber(HudWidget *w, uint16_t value);
+
+/**
+ * @brief Moves the anchor; dirty only if it moved.
+ */
+void hudSetPosition(HudWidget *w, int x, int y);
+
+/**
+ * @brief Resizes a bar from its left edge; dirty only if the width changed.
+ */
+void hudSetBarWidth(HudWidget *w, int width);
+
+/**
+ * @brief Shows or hides the widget; dirty only if that changes.
+ */
+void hudSetVisible(HudWidget *w, bool visible);
+
+/**
+ * @brief Forgets what is in the framebuffer and marks every widget dirty.
+ * Call it after oledClear(), when a screen is entered.
+ */
+void hudInvalidate(HudWidget *const *widgets, size_t count);
+
+/**
+ * @brief Erases and redraws the dirty widgets, in array order (later on top).
+ * @return Bit mask of the pages that changed (bit n = page n)
+ */
+uint8_t hudRender(HudWidget *const *widgets, size_t count);
+
+#endif // HUD_H
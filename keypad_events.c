@@ -0,0 +1,318 @@
+/**
+ * @file keypad_events.c
+ * @brief Repeating-timer keypad scanner feeding an SPSC event ring buffer.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "keypad_events.h"
+#include "latency_trace.h"
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+#if PATROSUM_KEYPAD_PIO
+#include "hardware/pio.h"
+#include "hardware/irq.h"
+#include "keypad_scan.pio.h"
+#endif
+
+static const uint8_t rowPins[KEYPAD_ROWS] = KEYPAD_ROW_PINS;
+static const uint8_t colPins[KEYPAD_COLS] = KEYPAD_COL_PINS;
+
+// Fila SPSC: o timer (produtor) só escreve head, o loop (consumidor) só escreve tail.
+static KeypadEvent eventQueue[KEYPAD_EVENT_QUEUE_SIZE];
+static volatile uint32_t eventHead = 0;
+static volatile uint32_t eventTail = 0;
+static volatile uint32_t droppedEvents = 0;
+static volatile uint32_t lastEventUs = 0;
+
+// Estado do debounce: bit (row * KEYPAD_COLS + col) = tecla pressionada
+static uint16_t debouncedState = 0;
+static uint8_t debounceCount[KEYPAD_ROWS * KEYPAD_COLS];
+static uint32_t changeSeenUs[KEYPAD_ROWS * KEYPAD_COLS]; // Varredura que viu a mudança primeiro
+static uint8_t settleCount[KEYPAD_ROWS * KEYPAD_COLS];    // Leituras de volta ao estado antigo
+static uint16_t changePending = 0; // Bit por tecla com mudança já carimbada e ainda sem confirmação
+
+static repeating_timer_t scanTimer;
+static uint32_t scanPeriodUs = KEYPAD_SCAN_PERIOD_US;
+static bool usingPio = false;
+static volatile bool wakePending = false;
+
+static void __not_in_flash_func(pushEvent)(uint8_t row, uint8_t col, bool pressed, uint32_t now)
+{
+  uint32_t head = eventHead;
+  if (head - eventTail >= KEYPAD_EVENT_QUEUE_SIZE)
+  {
+    droppedEvents++;
+    return;
+  }
+
+  KeypadEvent *evt = &eventQueue[head % KEYPAD_EVENT_QUEUE_SIZE];
+  evt->row = row;
+  evt->col = col;
+  evt->pressed = pressed;
+  evt->timestamp_us = now;
+
+  __dmb(); // Publica o evento antes de avançar o índice
+  eventHead = head + 1;
+  lastEventUs = now;
+
+  if (pressed)
+    LATENCY_MARK(LATENCY_DETECTED);
+}
+
+/**
+ * @brief Reads the raw state of the whole matrix.
+ * @return Bitmask with bit (row * KEYPAD_COLS + col) set for every closed key
+ */
+static uint16_t __not_in_flash_func(readMatrix)(void)
+{
+  uint16_t raw = 0;
+
+  for (int r = 0; r < KEYPAD_ROWS; r++)
+  {
+    gpio_put(rowPins[r], 0); // Linha ativa em nível baixo
+    busy_wait_us_32(2);      // Tempo para a linha estabilizar
+
+    uint32_t closed = ~gpio_get_all() & KEYPAD_COL_MASK; // Uma leitura para a linha toda
+#if KEYPAD_COLS_CONSECUTIVE
+    raw |= (uint16_t)((closed >> KEYPAD_COL0_PIN) << (r * KEYPAD_COLS));
+#else
+    for (int c = 0; c < KEYPAD_COLS; c++)
+    {
+      if (closed & (1u << colPins[c]))
+        raw |= 1u << (r * KEYPAD_COLS + c);
+    }
+#endif
+
+    gpio_put(rowPins[r], 1);
+  }
+
+  return raw;
+}
+
+static bool __not_in_flash_func(scanTimerCallback)(repeating_timer_t *rt)
+{
+  (void)rt;
+
+  uint16_t raw = readMatrix();
+  uint16_t changed = raw ^ debouncedState;
+  uint32_t now = time_us_32();
+
+  for (int i = 0; i < KEYPAD_ROWS * KEYPAD_COLS; i++)
+  {
+    uint16_t bit = 1u << i;
+    if (!(changed & bit))
+    {
+      debounceCount[i] = 0;
+      // Um repique mantém o primeiro carimbo; só um estado antigo estável o descarta
+      if ((changePending & bit) && ++settleCount[i] >= KEYPAD_DEBOUNCE_SCANS)
+        changePending &= ~bit;
+      continue;
+    }
+
+    settleCount[i] = 0;
+    if (!(changePending & bit))
+    {
+      changePending |= bit;
+      changeSeenUs[i] = now; // O evento leva esse tempo, não o da confirmação
+      // Primeira leitura da tecla fechada: começa a medição de latência
+      if (raw & bit)
+        LATENCY_MARK(LATENCY_EDGE);
+    }
+
+    // Só aceita a mudança depois de KEYPAD_DEBOUNCE_SCANS leituras iguais
+    if (++debounceCount[i] >= KEYPAD_DEBOUNCE_SCANS)
+    {
+      debounceCount[i] = 0;
+      changePending &= ~bit;
+      debouncedState ^= bit;
+      pushEvent(i / KEYPAD_COLS, i % KEYPAD_COLS, (debouncedState & bit) != 0, changeSeenUs[i]);
+    }
+  }
+
+  return true; // Mantém o timer ativo
+}
+
+#if PATROSUM_KEYPAD_PIO
+static PIO keypadPio = pio0;
+static uint keypadSm;
+static uint16_t lastSnapshot = 0xFFFF; // Todas as teclas soltas
+
+/**
+ * @brief Converts PIO snapshots into key events.
+ * Runs only when the state machine reports that the matrix changed.
+ */
+static void __not_in_flash_func(keypadPioIrqHandler)(void)
+{
+  // A PIO não informa quando a varredura aconteceu: o carimbo é o da interrupção,
+  // até KEYPAD_PIO_SCAN_PERIOD_US depois do contato mais o tempo com o IRQ mascarado
+  uint32_t now = time_us_32();
+
+  while (!pio_sm_is_rx_fifo_empty(keypadPio, keypadSm))
+  {
+    uint16_t snapshot = (uint16_t)pio_sm_get(keypadPio, keypadSm);
+    uint16_t changed = snapshot ^ lastSnapshot;
+    lastSnapshot = snapshot;
+
+    for (int r = 0; r < KEYPAD_ROWS; r++)
+    {
+      for (int c = 0; c < KEYPAD_COLS; c++)
+      {
+        // A linha 0 ocupa os bits mais altos; bit em 0 = tecla fechada
+        uint16_t bit = 1u << ((KEYPAD_ROWS - 1 - r) * KEYPAD_COLS + c);
+        if (!(changed & bit))
+          continue;
+
+        bool pressed = !(snapshot & bit);
+        if (pressed)
+          LATENCY_MARK(LATENCY_EDGE); // A PIO já faz o debounce: borda e detecção coincidem
+        pushEvent(r, c, pressed, now);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Starts the PIO scanner.
+ * @return false if the wiring or the PIO block can't support it
+ */
+static bool initPioScanner(void)
+{
+  // O programa usa SET/IN com pinos consecutivos para linhas e colunas
+  if (!KEYPAD_ROWS_CONSECUTIVE || !KEYPAD_COLS_CONSECUTIVE)
+    return false;
+  if (!pio_can_add_program(keypadPio, &keypad_scan_program))
+    return false;
+
+  int sm = pio_claim_unused_sm(keypadPio, false);
+  if (sm < 0)
+    return false;
+  keypadSm = (uint)sm;
+
+  uint offset = pio_add_program(keypadPio, &keypad_scan_program);
+  irq_set_exclusive_handler(PIO0_IRQ_0, keypadPioIrqHandler);
+  pio_set_irq0_source_enabled(keypadPio, pio_get_rx_fifo_not_empty_interrupt_source(keypadSm), true);
+  irq_set_enabled(PIO0_IRQ_0, true);
+
+  keypad_scan_program_init(keypadPio, keypadSm, offset, rowPins[0], colPins[0], KEYPAD_PIO_SCAN_PERIOD_US);
+  return true;
+}
+#endif
+
+void initKeypadEvents(void)
+{
+  initKeypad();
+
+  // Reconfigura a matriz para a varredura em segundo plano:
+  // linhas como saída em repouso alto, colunas como entrada com pull-up.
+  gpio_init_mask(KEYPAD_ROW_MASK | KEYPAD_COL_MASK);
+  gpio_set_mask(KEYPAD_ROW_MASK);
+  gpio_set_dir_out_masked(KEYPAD_ROW_MASK);
+  for (int c = 0; c < KEYPAD_COLS; c++)
+    gpio_pull_up(colPins[c]);
+
+  lastEventUs = time_us_32(); // O tempo ocioso conta a partir daqui
+
+#if PATROSUM_KEYPAD_PIO
+  if (initPioScanner())
+  {
+    usingPio = true;
+    scanPeriodUs = KEYPAD_PIO_SCAN_PERIOD_US;
+    return;
+  }
+  // Sem suporte a PIO nesta ligação: segue com a varredura por timer
+#endif
+
+  add_repeating_timer_us(-KEYPAD_SCAN_PERIOD_US, scanTimerCallback, NULL, &scanTimer);
+}
+
+bool __not_in_flash_func(keypadPollEvent)(KeypadEvent *evt)
+{
+  uint32_t tail = eventTail;
+  if (tail == eventHead)
+    return false;
+
+  __dmb(); // Lê o evento só depois de ver o head atualizado
+  *evt = eventQueue[tail % KEYPAD_EVENT_QUEUE_SIZE];
+  eventTail = tail + 1;
+  return true;
+}
+
+void keypadFlushEvents(void)
+{
+  eventTail = eventHead;
+}
+
+uint32_t keypadDroppedEvents(void)
+{
+  return droppedEvents;
+}
+
+uint32_t keypadLastEventUs(void)
+{
+  return lastEventUs;
+}
+
+static void wakeIrqCallback(uint gpio, uint32_t events)
+{
+  (void)gpio;
+  (void)events;
+  wakePending = true;
+}
+
+void keypadSuspend(void)
+{
+#if PATROSUM_KEYPAD_PIO
+  if (usingPio)
+    pio_sm_set_enabled(keypadPio, keypadSm, false);
+  else
+#endif
+    cancel_repeating_timer(&scanTimer);
+
+  wakePending = false;
+
+  // Com todas as linhas em nível baixo, qualquer tecla puxa a sua coluna para baixo
+  gpio_init_mask(KEYPAD_ROW_MASK); // Devolve as linhas ao SIO (podem estar com a PIO)
+  gpio_clr_mask(KEYPAD_ROW_MASK);
+  gpio_set_dir_out_masked(KEYPAD_ROW_MASK);
+  for (int c = 0; c < KEYPAD_COLS; c++)
+    gpio_set_irq_enabled_with_callback(colPins[c], GPIO_IRQ_EDGE_FALL, true, wakeIrqCallback);
+}
+
+bool keypadWakePending(void)
+{
+  return wakePending;
+}
+
+void keypadResume(void)
+{
+  for (int c = 0; c < KEYPAD_COLS; c++)
+    gpio_set_irq_enabled(colPins[c], GPIO_IRQ_EDGE_FALL, false);
+  gpio_set_mask(KEYPAD_ROW_MASK);
+
+#if PATROSUM_KEYPAD_PIO
+  if (usingPio)
+  {
+    for (int r = 0; r < KEYPAD_ROWS; r++)
+      pio_gpio_init(keypadPio, rowPins[r]);
+    pio_sm_set_enabled(keypadPio, keypadSm, true);
+    return;
+  }
+#endif
+
+  add_repeating_timer_us(-KEYPAD_SCAN_PERIOD_US, scanTimerCallback, NULL, &scanTimer);
+}
+
+bool keypadUsingPio(void)
+{
+  return usingPio;
+}
+
+uint32_t keypadScanPeriodUs(void)
+{
+  return scanPeriodUs;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file keypad_events.h
+ * @brief Background keypad scanning with a debounced event queue.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * A repeating timer scans the 4x4 matrix at a fixed rate, debounces each key
+ * and pushes press/release events into a lock-free single-producer/single-consumer
+ * ring buffer. The game loop drains the queue whenever it is ready, so keys typed
+ * while the display is being updated are never lost.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef KEYPAD_EVENTS_H
+#define KEYPAD_EVENTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "keypad.h"
+
+/** Período da varredura em microssegundos. */
+#ifndef KEYPAD_SCAN_PERIOD_US
+#define KEYPAD_SCAN_PERIOD_US 1000
+#endif
+
+/** Varreduras consecutivas iguais para aceitar uma mudança (debounce). */
+#ifndef KEYPAD_DEBOUNCE_SCANS
+#define KEYPAD_DEBOUNCE_SCANS 5
+#endif
+
+/**
+ * Período da varredura feita pela PIO (PATROSUM_KEYPAD_PIO). Maior que o tempo
+ * de trepidação dos contatos, o que já serve como debounce.
+ */
+#ifndef KEYPAD_PIO_SCAN_PERIOD_US
+#define KEYPAD_PIO_SCAN_PERIOD_US 10000
+#endif
+
+/** Capacidade da fila de eventos (potência de 2). */
+#define KEYPAD_EVENT_QUEUE_SIZE 32
+
+/**
+ * @brief A debounced key transition.
+ */
+typedef struct
+{
+  uint8_t row;
+  uint8_t col;
+  bool pressed;          // true = tecla pressionada, false = solta
+  uint32_t timestamp_us; // time_us_32() da primeira varredura que viu a mudança (erro <= um período)
+} KeypadEvent;
+
+/**
+ * @brief Initializes the keypad pins and starts the background scan.
+ * Replaces direct calls to initKeypad() in the game.
+ *
+ * When built with PATROSUM_KEYPAD_PIO and the rows and columns are each on
+ * consecutive pins, the matrix is scanned by a PIO state machine and the CPU
+ * is only interrupted when a key changes. Otherwise a repeating timer is used.
+ */
+void initKeypadEvents(void);
+
+/**
+ * @brief Pops the oldest pending event.
+ * @param evt Receives the event
+ * @return true if an event was available
+ */
+bool keypadPollEvent(KeypadEvent *evt);
+
+/**
+ * @brief Discards all pending events.
+ */
+void keypadFlushEvents(void);
+
+/**
+ * @brief Number of events dropped because the queue was full.
+ */
+uint32_t keypadDroppedEvents(void);
+
+/**
+ * @brief time_us_32() of the most recent key transition (or of the init).
+ * Used to measure how long the keypad has been idle.
+ */
+uint32_t keypadLastEventUs(void);
+
+/**
+ * @brief Stops the background scan and arms a wake-up on any key.
+ *
+ * All rows are driven low and every column gets a falling edge interrupt,
+ * so the CPU can sleep in __wfi() (or go dormant) until a key is pressed.
+ */
+void keypadSuspend(void);
+
+/**
+ * @brief Returns true once a key was pressed after keypadSuspend().
+ */
+bool keypadWakePending(void);
+
+/**
+ * @brief Disarms the wake-up and restarts the background scan.
+ */
+void keypadResume(void);
+
+/**
+ * @brief Returns true if the PIO scanner is active.
+ */
+bool keypadUsingPio(void);
+
+/**
+ * @brief Time between two complete scans of the matrix, in microseconds.
+ */
+uint32_t keypadScanPeriodUs(void);
+
+#endif // KEYPAD_EVENTS_H
@@ -0,0 +1,152 @@
+/**
+ * @file latency_trace.c
+ * @brief Per-stage key press timestamps and latency histograms.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Only one press is traced at a time: a press takes tens of milliseconds
+ * to go through the pipeline, less than the time between two presses, and
+ * a new edge simply closes the trace of the previous one.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "latency_trace.h"
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+static const char *const stageNames[LATENCY_STAGE_COUNT] = {
+    "borda", "deteccao", "entrada", "som", "painel"};
+
+// Medição em andamento
+static uint32_t stamps[LATENCY_STAGE_COUNT];
+static uint32_t reachedMask = 0; // Bit por etapa já marcada; 0 = nenhuma medição
+static spin_lock_t *traceLock;
+
+// Histogramas desde o boot, por etapa, contados a partir da borda
+static uint32_t histogram[LATENCY_STAGE_COUNT][LATENCY_BUCKETS + 1];
+static uint32_t samples[LATENCY_STAGE_COUNT];
+static uint32_t maxUs[LATENCY_STAGE_COUNT];
+
+static uint32_t presses = 0;
+static uint32_t reportedPresses = 0;
+static absolute_time_t lastReport;
+
+/**
+ * @brief Adds the stages reached by the current trace to the histograms.
+ * A trace that never reached LATENCY_DETECTED was a glitch, not a press,
+ * and is dropped. Called with the lock held.
+ */
+static void closeTrace(void)
+{
+  uint32_t detected = (1u << LATENCY_EDGE) | (1u << LATENCY_DETECTED);
+  if ((reachedMask & detected) != detected)
+  {
+    reachedMask = 0;
+    return;
+  }
+
+  presses++;
+  for (int s = LATENCY_EDGE + 1; s < LATENCY_STAGE_COUNT; s++)
+  {
+    if (!(reachedMask & (1u << s)))
+      continue;
+
+    uint32_t us = stamps[s] - stamps[LATENCY_EDGE];
+    uint32_t bucket = us / LATENCY_BUCKET_US;
+    histogram[s][bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS]++;
+    samples[s]++;
+    if (us > maxUs[s])
+      maxUs[s] = us;
+  }
+  reachedMask = 0;
+}
+
+void latencyInit(void)
+{
+  traceLock = spin_lock_init(spin_lock_claim_unused(true));
+  lastReport = get_absolute_time();
+
+#if LATENCY_TRACE_PIN >= 0
+  gpio_init(LATENCY_TRACE_PIN);
+  gpio_set_dir(LATENCY_TRACE_PIN, GPIO_OUT);
+  gpio_put(LATENCY_TRACE_PIN, 0);
+#endif
+}
+
+void __not_in_flash_func(latencyMark)(LatencyStage stage)
+{
+  uint32_t now = time_us_32();
+
+#if LATENCY_TRACE_PIN >= 0
+  gpio_xor_mask(1u << LATENCY_TRACE_PIN); // Uma transição por etapa no analisador lógico
+#endif
+
+  uint32_t irq = spin_lock_blocking(traceLock);
+  if (stage == LATENCY_EDGE)
+  {
+    closeTrace();
+    reachedMask = 1u << LATENCY_EDGE;
+    stamps[LATENCY_EDGE] = now;
+  }
+  else if (reachedMask && !(reachedMask & (1u << stage)))
+  {
+    reachedMask |= 1u << stage;
+    stamps[stage] = now;
+    if (stage == LATENCY_DISPLAY)
+      closeTrace();
+  }
+  spin_unlock(traceLock, irq);
+}
+
+void latencyDisplayCommitted(void)
+{
+  latencyMark(LATENCY_DISPLAY);
+}
+
+/**
+ * @brief Upper bound of the bucket that holds the given fraction of samples.
+ */
+static uint32_t percentileUs(int stage, uint32_t permille)
+{
+  uint32_t target = (samples[stage] * permille + 999) / 1000; // Arredonda para cima
+  uint32_t seen = 0;
+  for (int b = 0; b < LATENCY_BUCKETS; b++)
+  {
+    seen += histogram[stage][b];
+    if (seen >= target)
+    {
+      uint32_t bound = (uint32_t)(b + 1) * LATENCY_BUCKET_US;
+      return bound < maxUs[stage] ? bound : maxUs[stage];
+    }
+  }
+  return maxUs[stage]; // Caiu na faixa de transbordo
+}
+
+void latencyReport(void)
+{
+  absolute_time_t now = get_absolute_time();
+  if (absolute_time_diff_us(lastReport, now) < (int64_t)LATENCY_REPORT_MS * 1000)
+    return;
+  lastReport = now;
+  if (presses == reportedPresses)
+    return;
+  reportedPresses = presses;
+
+  // Leitura sem trava: uma tecla no meio do relatório só desloca uma amostra
+  printf("[latencia] %lu teclas, a partir da borda, p50/p99/max (us):\n", (unsigned long)presses);
+  for (int s = LATENCY_EDGE + 1; s < LATENCY_STAGE_COUNT; s++)
+  {
+    if (samples[s] == 0)
+      continue;
+    printf("  %-9s %6lu %6lu %6lu  (%lu)\n",
+           stageNames[s],
+           (unsigned long)percentileUs(s, 500),
+           (unsigned long)percentileUs(s, 990),
+           (unsigned long)maxUs[s],
+           (unsigned long)samples[s]);
+  }
+}
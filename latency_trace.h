@@ -0,0 +1,80 @@
+/**
+ * @file latency_trace.h
+ * @brief Keypress-to-feedback latency tracing (debug builds only).
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Each key press is timestamped at every stage of the pipeline, from the
+ * first scan that sees the key close to the panel flush that shows its
+ * effect. Latencies from the first stage are kept in histograms, and
+ * p50/p99/max are printed over stdio every LATENCY_REPORT_MS. Optionally,
+ * a GPIO toggles at each stage for a logic analyser.
+ *
+ * Without PATROSUM_LATENCY_TRACE the LATENCY_* macros expand to nothing
+ * and latency_trace.c is not built.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+#include "board.h"
+
+typedef enum
+{
+  LATENCY_EDGE,     // Primeira varredura que vê a tecla fechar (antes do debounce)
+  LATENCY_DETECTED, // Evento com debounce entra na fila
+  LATENCY_INPUT,    // O jogo consome o evento e atualiza a resposta
+  LATENCY_FEEDBACK, // O som de retorno começa
+  LATENCY_DISPLAY,  // Termina o envio do quadro que mostra a mudança
+  LATENCY_STAGE_COUNT
+} LatencyStage;
+
+#if PATROSUM_LATENCY_TRACE
+
+#ifndef LATENCY_REPORT_MS
+#define LATENCY_REPORT_MS 5000
+#endif
+
+/** Histograma: LATENCY_BUCKETS faixas de LATENCY_BUCKET_US (32 ms), mais uma para o resto. */
+#define LATENCY_BUCKET_US 250
+#define LATENCY_BUCKETS 128
+
+/**
+ * @brief Claims the spin lock and sets up the trace pin.
+ */
+void latencyInit(void);
+
+/**
+ * @brief Timestamps a stage of the key press being traced.
+ * LATENCY_EDGE starts a new trace (closing the previous one, which counts
+ * only if it reached LATENCY_DETECTED); other stages are kept only once
+ * per trace; LATENCY_DISPLAY closes it. Safe from any core and from
+ * interrupts.
+ */
+void latencyMark(LatencyStage stage);
+
+/**
+ * @brief Flush-complete callback that marks LATENCY_DISPLAY.
+ */
+void latencyDisplayCommitted(void);
+
+/**
+ * @brief Prints the histograms if LATENCY_REPORT_MS passed and there are new presses.
+ */
+void latencyReport(void);
+
+#define LATENCY_INIT() latencyInit()
+#define LATENCY_MARK(stage) latencyMark(stage)
+#define LATENCY_REPORT() latencyReport()
+
+#else
+
+#define LATENCY_INIT() ((void)0)
+#define LATENCY_MARK(stage) ((void)0)
+#define LATENCY_REPORT() ((void)0)
+
+#endif // PATROSUM_LATENCY_TRACE
+
+#endif // LATENCY_TRACE_H
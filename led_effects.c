@@ -0,0 +1,185 @@
+/**
+ * @file led_effects.c
+ * @brief Timer-driven effects for the RGB LED.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "led_effects.h"
+
+#include "pico/stdlib.h"
+#include "pico/sync.h"
+
+#define LED_COUNT 3
+
+typedef struct
+{
+  LedEffectType type;
+  uint8_t level;      // Brilho alvo / máximo
+  uint8_t levelFrom;  // Brilho de partida (fade)
+  uint8_t levelAfter; // Brilho final (blink)
+  uint8_t count;      // Piscadas (blink)
+  Easing easing;      // Curva do fade
+  uint16_t periodMs;
+  uint32_t startMs;
+} LedEffect;
+
+static const uint8_t ledPins[LED_COUNT] = {LED_RED_PIN, LED_GREEN_PIN, LED_BLUE_PIN};
+
+static LedEffect effects[LED_COUNT];
+static uint8_t currentLevel[LED_COUNT];
+static critical_section_t effectLock; // Protege effects[] entre os cores e o timer
+static repeating_timer_t effectTimer;
+
+static int slotForPin(uint8_t pin)
+{
+  for (int i = 0; i < LED_COUNT; i++)
+  {
+    if (ledPins[i] == pin)
+      return i;
+  }
+  return -1;
+}
+
+/**
+ * @brief Brightness of an effect at a given time.
+ */
+static uint8_t effectLevel(const LedEffect *fx, uint32_t nowMs)
+{
+  uint32_t t = nowMs - fx->startMs;
+
+  switch (fx->type)
+  {
+  case LED_EFFECT_PULSE:
+  {
+    // Onda triangular elevada ao quadrado: a subida fica mais natural ao olho
+    uint32_t phase = (t % fx->periodMs) * 512u / fx->periodMs; // 0..511
+    uint32_t tri = phase < 256 ? phase : 511 - phase;           // 0..255
+    return (uint8_t)((fx->level * tri * tri) / (255u * 255u));
+  }
+  case LED_EFFECT_BLINK:
+  {
+    uint32_t step = t / fx->periodMs;
+    if (step >= 2u * fx->count)
+      return fx->levelAfter;
+    return (step % 2 == 0) ? fx->level : 0;
+  }
+  case LED_EFFECT_FADE:
+  {
+    if (t >= fx->periodMs)
+      return fx->level;
+    int32_t delta = (int32_t)fx->level - fx->levelFrom;
+    int32_t eased = easeApply(fx->easing, t * TWEEN_PHASE_ONE / fx->periodMs);
+    int32_t level = fx->levelFrom + delta * eased / TWEEN_ONE;
+    return (uint8_t)(level < 0 ? 0 : (level > 255 ? 255 : level)); // EASE_OUT_BACK passa do alvo
+  }
+  case LED_EFFECT_SOLID:
+  default:
+    return fx->level;
+  }
+}
+
+static bool effectTimerCallback(repeating_timer_t *rt)
+{
+  (void)rt;
+  uint32_t nowMs = to_ms_since_boot(get_absolute_time());
+
+  for (int i = 0; i < LED_COUNT; i++)
+  {
+    // O nível mostrado muda sob a trava: ledFade() parte dele
+    critical_section_enter_blocking(&effectLock);
+    uint8_t level = effectLevel(&effects[i], nowMs);
+    bool changed = level != currentLevel[i];
+    currentLevel[i] = level;
+    critical_section_exit(&effectLock);
+
+    if (changed)
+      setLedBrightness(ledPins[i], level);
+  }
+
+  return true;
+}
+
+static void setEffect(uint8_t pin, const LedEffect *fx)
+{
+  int slot = slotForPin(pin);
+  if (slot < 0)
+    return;
+
+  critical_section_enter_blocking(&effectLock);
+  effects[slot] = *fx;
+  effects[slot].startMs = to_ms_since_boot(get_absolute_time());
+  if (fx->type == LED_EFFECT_FADE)
+    effects[slot].levelFrom = currentLevel[slot]; // Na mesma trava: o timer não muda o nível entre a leitura e a troca
+  critical_section_exit(&effectLock);
+}
+
+void initLedEffects(void)
+{
+  initLeds();
+  critical_section_init(&effectLock);
+
+  for (int i = 0; i < LED_COUNT; i++)
+  {
+    effects[i] = (LedEffect){.type = LED_EFFECT_SOLID, .level = 0};
+    currentLevel[i] = 0;
+    setLedBrightness(ledPins[i], 0);
+  }
+
+  add_repeating_timer_ms(-LED_EFFECT_TICK_MS, effectTimerCallback, NULL, &effectTimer);
+}
+
+void ledSolid(uint8_t pin, uint8_t level)
+{
+  LedEffect fx = {.type = LED_EFFECT_SOLID, .level = level};
+  setEffect(pin, &fx);
+}
+
+void ledPulse(uint8_t pin, uint8_t maxLevel, uint16_t periodMs)
+{
+  LedEffect fx = {.type = LED_EFFECT_PULSE, .level = maxLevel, .periodMs = periodMs ? periodMs : 1};
+  setEffect(pin, &fx);
+}
+
+void ledBlink(uint8_t pin, uint8_t level, uint16_t halfPeriodMs, uint8_t times, uint8_t levelAfter)
+{
+  LedEffect fx = {
+      .type = LED_EFFECT_BLINK,
+      .level = level,
+      .levelAfter = levelAfter,
+      .count = times,
+      .periodMs = halfPeriodMs ? halfPeriodMs : 1,
+  };
+  setEffect(pin, &fx);
+}
+
+void ledFade(uint8_t pin, uint8_t level, uint16_t durationMs, Easing easing)
+{
+  LedEffect fx = {
+      .type = LED_EFFECT_FADE,
+      .level = level, // levelFrom vem do nível atual, lido por setEffect()
+      .easing = easing,
+      .periodMs = durationMs ? durationMs : 1,
+  };
+  setEffect(pin, &fx);
+}
+
+void ledEffectsSuspend(void)
+{
+  cancel_repeating_timer(&effectTimer);
+
+  for (int i = 0; i < LED_COUNT; i++)
+    ledSolid(ledPins[i], 0);
+  for (int i = 0; i < LED_COUNT; i++)
+  {
+    currentLevel[i] = 0;
+    setLedBrightness(ledPins[i], 0);
+  }
+}
+
+void ledEffectsResume(void)
+{
+  add_repeating_timer_ms(-LED_EFFECT_TICK_MS, effectTimerCallback, NULL, &effectTimer);
+}
@@ -0,0 +1,77 @@
+/**
+ * @file led_effects.h
+ * @brief Timer-driven effects for the RGB LED.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * An effect is declared once per LED (solid, pulse, blink N times, fade) and
+ * then advanced by a repeating timer, which writes the new brightness with
+ * setLedBrightness() only when it changes. The game loop does no per-frame
+ * LED math, and effects stay smooth even while a loop is busy.
+ *
+ * Effects may be set from either core.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef LED_EFFECTS_H
+#define LED_EFFECTS_H
+
+#include <stdint.h>
+
+#include "led.h"
+#include "tween.h"
+
+/** Período de atualização dos efeitos. */
+#ifndef LED_EFFECT_TICK_MS
+#define LED_EFFECT_TICK_MS 5
+#endif
+
+typedef enum
+{
+  LED_EFFECT_SOLID, // Brilho fixo
+  LED_EFFECT_PULSE, // Respiração contínua entre 0 e level
+  LED_EFFECT_BLINK, // Pisca count vezes e termina em levelAfter
+  LED_EFFECT_FADE   // Vai do brilho atual até level em periodMs, com easing
+} LedEffectType;
+
+/**
+ * @brief Initializes the LEDs and starts the effect timer.
+ * Replaces direct calls to initLeds() in the game.
+ */
+void initLedEffects(void);
+
+/**
+ * @brief Keeps the LED at a fixed brightness (0 turns it off).
+ */
+void ledSolid(uint8_t pin, uint8_t level);
+
+/**
+ * @brief Breathes the LED between off and maxLevel.
+ * @param periodMs Duration of one full breath
+ */
+void ledPulse(uint8_t pin, uint8_t maxLevel, uint16_t periodMs);
+
+/**
+ * @brief Blinks the LED a number of times, then holds levelAfter.
+ * @param halfPeriodMs Time on (and then off) for each blink
+ */
+void ledBlink(uint8_t pin, uint8_t level, uint16_t halfPeriodMs, uint8_t times, uint8_t levelAfter);
+
+/**
+ * @brief Fades from the current brightness to level along an easing curve.
+ */
+void ledFade(uint8_t pin, uint8_t level, uint16_t durationMs, Easing easing);
+
+/**
+ * @brief Turns every LED off and stops the effect timer, so it no longer
+ * wakes the CPU. The effects are reset to solid off.
+ */
+void ledEffectsSuspend(void);
+
+/**
+ * @brief Restarts the effect timer after ledEffectsSuspend().
+ */
+void ledEffectsResume(void);
+
+#endif // LED_EFFECTS_H
@@ -0,0 +1,55 @@
+/**
+ * @file lwipopts.h
+ * @brief lwIP configuration for the telemetry uploader (UDP + DHCP only).
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Read by pico_lwip when built with -DPATROSUM_TELEMETRY=ON. No RTOS, no
+ * sockets and no TCP: the uploader only sends UDP datagrams, so the stack
+ * is kept to what DHCP and UDP need.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef LWIPOPTS_H
+#define LWIPOPTS_H
+
+// Sem sistema operacional: o driver CYW43 roda o lwIP numa interrupção
+#define NO_SYS 1
+#define LWIP_SOCKET 0
+#define LWIP_NETCONN 0
+
+// Memória estática própria do lwIP (nada de malloc)
+#define MEM_LIBC_MALLOC 0
+#define MEM_ALIGNMENT 4
+#define MEM_SIZE 4000
+#define PBUF_POOL_SIZE 8
+#define MEMP_NUM_UDP_PCB 4
+#define MEMP_NUM_SYS_TIMEOUT (LWIP_NUM_SYS_TIMEOUT_INTERNAL + 1)
+
+// Protocolos
+#define LWIP_IPV4 1
+#define LWIP_IPV6 0
+#define LWIP_ARP 1
+#define LWIP_ETHERNET 1
+#define LWIP_ICMP 1
+#define LWIP_RAW 0
+#define LWIP_UDP 1
+#define LWIP_TCP 0
+#define LWIP_DHCP 1
+#define LWIP_DNS 0
+#define DHCP_DOES_ARP_CHECK 0
+#define LWIP_DHCP_DOES_ACD_CHECK 0
+
+// Interface
+#define LWIP_NETIF_STATUS_CALLBACK 1
+#define LWIP_NETIF_LINK_CALLBACK 1
+#define LWIP_NETIF_HOSTNAME 1
+#define LWIP_NETIF_TX_SINGLE_PBUF 1
+#define LWIP_CHKSUM_ALGORITHM 3
+
+// Sem estatísticas nem depuração
+#define LWIP_STATS 0
+#define LWIP_DEBUG 0
+
+#endif // LWIPOPTS_H
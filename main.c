@@ -24,242 +24,225 @@
 
 #include <stdio.h>
 #include "pico/stdlib.h"
+#include "hardware/structs/rosc.h"
 #include "buzzer.h"
-#include "keypad.h"
-#include "led.h"
-#include "approach.h"
+#include "keypad_events.h"
+#include "led_effects.h"
+#include "tone_sequencer.h"
+#include "game.h"
+#include "game_snapshot.h"
+#include "render.h"
+#include "frame_scheduler.h"
+#include "power.h"
+#include "stats_store.h"
 
 // Display
-#include "display.h"
-#include "text.h"
-#include "draw.h"
+#include "oled.h"
+#include "oled_draw.h"
+#include "latency_trace.h"
+#include "memory_guard.h"
+
+#if PATROSUM_TELEMETRY
+#include "telemetry.h"
+#endif
+
+/** Iterações por segundo da lógica do jogo (configurável no CMake). */
+#ifndef PATROSUM_LOGIC_HZ
+#define PATROSUM_LOGIC_HZ 100
+#endif
 
 /**
- * @brief Mapa de teclas para o teclado 4x4.
- * Cada posição corresponde ao caractere exibido na tecla.
+ * @brief Collects a seed from the ring oscillator's random bit.
+ *
+ * The ROSC runs asynchronously to the system clock, so its jitter makes each
+ * sampled bit unpredictable; waiting between samples lets the bits decorrelate.
  */
-const char keypad_key_map[4][4] = {
-    {'1', '2', '3', 'A'},
-    {'4', '5', '6', 'B'},
-    {'7', '8', '9', 'C'},
-    {'*', '0', '#', 'D'}};
+static uint64_t roscSeed(void)
+{
+  uint64_t seed = 0;
+  for (int i = 0; i < 64; i++)
+  {
+    seed = (seed << 1) | (rosc_hw->randombit & 1u);
+    busy_wait_us_32(2);
+  }
+  return seed;
+}
+
+// Melodia de boas-vindas, tocada em segundo plano enquanto o jogo começa
+static const ToneNote welcomeJingle[] = {
+    {523, 120, 30}, // C5
+    {659, 120, 30}, // E5
+    {784, 120, 30}, // G5
+    {1047, 240, 0}, // C6
+};
 
-// -- Game
+// Tempos do boot desde o reset, em microssegundos (0 = ainda não aconteceu)
+static volatile uint32_t firstPixelUs = 0;
+static uint32_t firstQuestionUs = 0;
+static bool bootReported = false;
 
-// Máquina de estados para controlar o fluxo do jogo
-typedef enum
+/**
+ * @brief End of the splash flush, called from the DMA interrupt.
+ */
+static void splashCommitted(void)
 {
-  GENERATE_NEW_QUESTION,
-  WAITING_FOR_INPUT,
-  CHECK_ANSWER
-} GameState;
-GameState currentGameState;
+  firstPixelUs = time_us_32();
+}
 
-// Questão atual
-int num1, num2, correctAnswer;
-char questionStr[32];  // "num1 + num 2 = "
-char answerBuffer[10]; // guarda a resposta do jogador
-float questionY = 20;
+/**
+ * @brief Puts the splash on the panel; the flush runs while the rest boots.
+ */
+static void showSplash(void)
+{
+  oledInit();
+  oledDrawTextCentered("Bem-vindo ao", 0);
+  oledDrawTextCentered("PatroSum", 16);
+  oledShowAsync(splashCommitted);
+}
 
-void generateQuestion()
+/**
+ * @brief Whether the first question has reached the panel; keeps the time it did.
+ * @param questionId Question currently in the snapshot (0 = none yet)
+ */
+static bool firstQuestionShown(uint32_t questionId)
 {
-  num1 = rand() % 1000;
-  num2 = rand() % 1000;
-  correctAnswer = num1 + num2;
-  sprintf(questionStr, "%d + %d = ?", num1, num2);
+  return firstQuestionUs || (questionId && readQuestionShown(questionId, &firstQuestionUs));
 }
 
 /**
- * @brief Pisca o LED vermelho conectado ao pino 13.
- * @param times Quantas vezes piscar
- * @param delay_ms Delay em ms entre liga/desliga
+ * @brief Prints the boot times once, as soon as someone can read them.
+ * @param questionId Question currently in the snapshot (0 = none yet)
  */
-void blink_led_red(int times, int delay_ms)
+static void reportBootTimes(uint32_t questionId)
 {
-  for (int i = 0; i < times; i++)
+  if (bootReported)
+    return;
+  if (!firstQuestionShown(questionId))
+    return;
+#if LIB_PICO_STDIO_USB
+  if (!stdio_usb_connected())
+    return; // A enumeração da USB costuma terminar depois da primeira pergunta
+#endif
+  bootReported = true;
+  printf("[boot] primeiro quadro em %lu ms, primeira pergunta em %lu ms\n",
+         (unsigned long)(firstPixelUs / 1000), (unsigned long)(firstQuestionUs / 1000));
+}
+
+#if PATROSUM_TELEMETRY
+/**
+ * @brief Brings the radio up once the first question is on the panel, then polls it.
+ * cyw43_arch_init() loads the CYW43 firmware synchronously: in setup() that
+ * wait would come before the first question.
+ */
+static void serviceTelemetry(uint32_t questionId)
+{
+  static bool started = false;
+  if (started)
   {
-    gpio_put(LED_RED_PIN, 1);
-    sleep_ms(delay_ms);
-    gpio_put(LED_RED_PIN, 0);
-    sleep_ms(delay_ms);
+    telemetryPoll(); // Envia um lote quando houver rede e algo pendente
+    return;
   }
+  if (!firstQuestionShown(questionId))
+    return;
+
+  started = true;
+  telemetryInit();     // Espera o firmware do rádio; as teclas ficam na fila enquanto isso
+  MEMORY_GUARD_SEAL(); // O driver do rádio aloca ao iniciar: o fim do setup passa a ser aqui
 }
+#endif
 
 /**
- * @brief Initializes the standard IO, buzzer, and keypad.
+ * @brief Brings the board up in stages, display first.
  *
- * This function should be called once at the beginning of main().
+ * The splash goes out by DMA right after the SSD1306 init, and the USB
+ * stack, sound, keypad and LEDs are set up while it is being sent. The
+ * welcome jingle is queued, not waited for. The telemetry radio comes up
+ * later, from the main loop, once the first question is shown. Call it
+ * once at the beginning of main().
  */
 void setup()
 {
-  stdio_init_all();
-  initBuzzerPWM();
-  initKeypad();
-  initDisplay();
-  initLeds();
-
-  // Inicializa o gerador de números aleatórios com um valor único
-  srand(time_us_32());
-
-  // Define o estado inicial do jogo
-  currentGameState = GENERATE_NEW_QUESTION;
+  MEMORY_GUARD_INIT(); // Primeiro: pinta as pilhas antes de qualquer uso
+  showSplash();        // Antes de tudo: o display é o que o jogador vê primeiro
 
-  // Limpa o buffer de resposta inicial
-  memset(answerBuffer, 0, sizeof(answerBuffer));
+  stdio_init_all(); // A enumeração da USB continua em segundo plano
+  LATENCY_INIT();   // Antes do teclado: a varredura já marca as etapas
+  initBuzzerPWM();
+  initToneSequencer();
+  // Toca em segundo plano: o primeiro som do jogo interrompe o jingle em vez de esperar
+  playBackgroundTones(welcomeJingle, sizeof(welcomeJingle) / sizeof(welcomeJingle[0]));
+  initKeypadEvents();
+  initLedEffects();
+  powerInit(); // O rádio da telemetria só sobe depois da primeira pergunta (serviceTelemetry)
+
+  // Semente do gerador de perguntas vinda do oscilador em anel
+  gameInit(roscSeed());
+  statsStorePrepare(); // Apaga já o próximo setor do log: durante o jogo só há gravações de página
+
+  MEMORY_GUARD_SEAL(); // Daqui em diante nada deve usar o heap
 }
 
-uint8_t row, col;
-
 /**
  * @brief Main program entry point.
  *
- * Initializes peripherals and enters the main loop, scanning the keypad and playing tones.
+ * Initializes peripherals and runs the game state machine, handling keypad
+ * events and audio. Drawing and LED effects happen in the render pipeline,
+ * on core 1 when built with PATROSUM_DUAL_CORE. When nobody plays for a
+ * while the loop switches to the attract screen and then sleeps (power.h).
  * @return int Program exit status (never returns in embedded context).
  */
 int main()
 {
   setup();
 
-  clearDisplay();
-  playWelcomeTones();
+  GameSnapshot snapshot = {.powerMode = POWER_ACTIVE};
+  gameFillSnapshot(&snapshot);
+  publishGameSnapshot(&snapshot);
 
-  drawTextCentered("Bem-vindo ao", 0);
-  drawTextCentered("PatroSum", 16);
-  showDisplay();
+#if PATROSUM_DUAL_CORE
+  startRenderCore(); // A partir daqui o display e os LEDs pertencem ao core 1
+#endif
 
-  char str[32] = "";
+  FrameScheduler scheduler;
+  frameSchedulerInit(&scheduler, "logic", PATROSUM_LOGIC_HZ);
 
   while (true)
   {
-    // Maquina de estados
-    switch (currentGameState)
-    {
-    case GENERATE_NEW_QUESTION:
-      generateQuestion();
-      memset(answerBuffer, 0, sizeof(answerBuffer)); // Limpa a resposta anterior
-      currentGameState = WAITING_FOR_INPUT;
-      questionY = 20; // Reseta a posição Y da pergunta
-      break;
-    case WAITING_FOR_INPUT:
-    {
-      pulseLed(LED_RED_PIN, 0.20);
-      pulseLed(LED_GREEN_PIN, 0.20);
-      pulseLed(LED_BLUE_PIN, 0.20);
+    uint32_t dtUs = frameBegin(&scheduler);
 
-      KeyEvent evt = keypadScan();
-      if (evt.pressed)
-      {
-        char key = keypad_key_map[evt.row][evt.col];
-        size_t len = strlen(answerBuffer);
+    // Sem teclas por muito tempo o jogo vai para a tela de espera e depois dorme
+    PowerMode power = powerUpdate(snapshot.state);
 
-        // Se for um dígito, adiciona ao buffer
-        if (key >= '0' && key <= '9' && len < sizeof(answerBuffer) - 1)
-        {
-          answerBuffer[len] = key;
-          answerBuffer[len + 1] = '\0';
-          playTone(440, 50); // Beep de feedback
-        }
-        // Se for 'A', vai para a verificação
-        else if (key == 'A')
-        {
-          int answerLength = strlen(answerBuffer);
-          if (answerLength == 0)
-          {
-            drawTextCentered("Digite a resposta", 7);
-            showDisplay();
-            sleep_ms(1000); // Espera um pouco para o usuário ver
-            continue;       // Volta para esperar mais input
-          }
-          currentGameState = CHECK_ANSWER;
-        }
-        // Se for '*', limpa o buffer
-        else if (key == '*')
-        {
-          memset(answerBuffer, 0, sizeof(answerBuffer));
-          playTone(220, 50); // Beep diferente para limpar
-        }
+    // Maquina de estados (parada enquanto a tela de espera estiver ativa)
+    if (power == POWER_ACTIVE)
+      gameUpdate();
 
-        // Aguarda um pouco para evitar leituras múltiplas (debounce)
-        sleep_ms(6);
-      }
-    }
-    break;
-    case CHECK_ANSWER:
-    {
-      int playerAnswer = atoi(answerBuffer); // Converte a string da resposta para inteiro
-      clearDisplay();
+    gameFillSnapshot(&snapshot);
+    snapshot.powerMode = power;
+    publishGameSnapshot(&snapshot);
 
-      if (playerAnswer == correctAnswer)
-      {
-        setLedBrightness(LED_RED_PIN, 0);     // Desliga o LED vermelho
-        setLedBrightness(LED_GREEN_PIN, 255); // Liga o LED verde
-        setLedBrightness(LED_BLUE_PIN, 0);    // Desliga o LED azul
-        drawTextCentered("Correto! :)", 8);
-        playTone(523, 150); // C5
-        sleep_ms(100);
-        playTone(659, 150); // E5
-        sleep_ms(100);
-        playTone(784, 150); // G5
-      }
-      else
-      {
-        setLedBrightness(LED_RED_PIN, 255); // Liga o LED vermelho
-        setLedBrightness(LED_GREEN_PIN, 0); // Desliga o LED verde
-        setLedBrightness(LED_BLUE_PIN, 0);  // Desliga o LED azul
-        drawTextCentered("Errado! :(", 0);
-        char correct_str[32];
-        sprintf(correct_str, "Resp: %d", correctAnswer);
-        drawTextCentered(correct_str, 16);
-        blink_led_red(3, 150);
-        playTone(261, 500); // C4 (som de erro)
-      }
-      showDisplay();
-      sleep_ms(2000); // Pausa para o jogador ver o resultado
-      currentGameState = GENERATE_NEW_QUESTION;
-    }
-    break;
-    }
+#if !PATROSUM_DUAL_CORE
+    // Sem o core 1, o próprio loop desenha o quadro
+    renderFrame(&snapshot, dtUs);
+#else
+    (void)dtUs;
+#endif
 
-    // --- Lógica de Desenho na Tela ---
-    // Esta parte é executada a cada ciclo, exceto durante a tela de resultado
-    if (currentGameState == WAITING_FOR_INPUT)
+    if (power == POWER_SLEEP)
     {
-      clearDisplay();
-
-      // Desenha retangulo no topo
-      int _rectHeight = 4;
-      drawRectangle(0, 0, SCREEN_WIDTH, _rectHeight);
-      drawRectangle(0, SCREEN_HEIGHT - _rectHeight, SCREEN_WIDTH, SCREEN_HEIGHT);
-
-      size_t len = strlen(answerBuffer);
-      float _newQuestionY = len > 0 ? 12.0 : 20.0; // Ajusta a posição Y da pergunta se houver resposta
-      questionY = approach(questionY, _newQuestionY, 1);
-      drawTextCentered("Resolva a conta:", questionY);
-      drawTextCentered(questionStr, questionY + 16);
-      // Desenha a resposta do usuário ao lado da pergunta
-      drawTextCentered(answerBuffer, 40);
-
-      if (len > 0)
-      {
-        // Desenhar instrução para enviar resposta
-        // drawTextCentered("Pressione A", 52);
-
-        // Desenhar instrução para enviar
-        drawText(0, SCREEN_HEIGHT - 20, "A");
-        drawText(0, SCREEN_HEIGHT - 13, "enviar");
-
-        // Desenhar instrução para limpar resposta
-        char _clearStr[32] = "*";
-        int _x = SCREEN_WIDTH - (strlen(_clearStr) * 6) - 2; // Calcula a posição X para alinhar à direita
-        drawText(_x, SCREEN_HEIGHT - 20, _clearStr);
-
-        strcpy(_clearStr, "limpar");
-        _x = SCREEN_WIDTH - (strlen(_clearStr) * 6) - 2; // Recalcula a posição X
-        drawText(_x, SCREEN_HEIGHT - 13, _clearStr);
-      }
-      showDisplay();
+      powerSleep(); // Volta quando uma tecla for pressionada
+      frameSchedulerResync(&scheduler);
+      continue;
     }
 
-    sleep_ms(10); // Pequeno delay no loop principal
+    reportBootTimes(snapshot.questionId);
+    LATENCY_REPORT();
+    MEMORY_GUARD_REPORT();
+#if PATROSUM_TELEMETRY
+    serviceTelemetry(snapshot.questionId);
+#endif
+
+    // Mantém o ritmo do loop; as teclas continuam sendo capturadas pelo timer
+    frameEnd(&scheduler);
   }
 }
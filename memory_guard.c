@@ -0,0 +1,149 @@
+/**
+ * @file memory_guard.c
+ * @brief Stack painting, heap call counting and the periodic memory report.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The stacks are painted once and scanned from the bottom: the first word
+ * that lost the pattern is the deepest point reached since boot. Heap calls
+ * are counted by wrapping __malloc_lock() (linked with --wrap), which newlib
+ * calls on every malloc, free and realloc, so allocations made inside
+ * patroLibs or the SDK are seen as well.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "memory_guard.h"
+
+#include <malloc.h>
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+#if PATROSUM_DUAL_CORE && !PICO_USE_MALLOC_MUTEX
+#error "PATROSUM_MEMORY_GUARD: with two cores the heap counter relies on PICO_USE_MALLOC_MUTEX"
+#endif
+
+/** Padrão das pilhas ainda não usadas. */
+#define STACK_PAINT 0xA5A5A5A5u
+
+/** Folga abaixo do sp na hora de pintar a pilha do core 0 (quadro da própria pintura). */
+#define STACK_PAINT_MARGIN_WORDS 16
+
+// Regiões definidas pelo linker script do SDK
+extern uint32_t __StackBottom, __StackTop;
+extern uint32_t __StackOneBottom, __StackOneTop;
+extern uint8_t __end__, __HeapLimit;
+
+struct _reent;
+
+void __real___malloc_lock(struct _reent *reent);
+
+static volatile uint32_t heapCalls = 0; // Desde o boot
+static volatile bool sealed = false;
+static uint32_t heapCallsAtSeal = 0;
+static uint32_t heapInUseAtSeal = 0;
+
+// O que foi impresso no último relatório
+static uint32_t reportedStack[2];
+static uint32_t reportedInUse = 0;
+static uint32_t reportedCalls = UINT32_MAX;
+static absolute_time_t lastReport;
+
+/**
+ * @brief Locking hook of newlib's allocator: takes the original lock, then counts.
+ * The increment is not atomic on the M0+; in dual-core builds the SDK's malloc
+ * wrapper (PICO_USE_MALLOC_MUTEX) keeps the two cores out of here at once.
+ */
+void __wrap___malloc_lock(struct _reent *reent)
+{
+  __real___malloc_lock(reent);
+  heapCalls++;
+}
+
+static void paintStack(uint32_t *bottom, uint32_t *top)
+{
+  for (uint32_t *word = bottom; word < top; word++)
+    *word = STACK_PAINT;
+}
+
+/**
+ * @brief Bytes of the stack used at its deepest point since it was painted.
+ */
+static uint32_t stackPeak(const uint32_t *bottom, const uint32_t *top)
+{
+  const uint32_t *word = bottom;
+  while (word < top && *word == STACK_PAINT)
+    word++;
+  return (uint32_t)(top - word) * sizeof(uint32_t);
+}
+
+void memoryGuardInit(void)
+{
+  uint32_t *sp;
+  __asm volatile("mov %0, sp" : "=r"(sp));
+
+  // Interrupções também empilham na pilha do core 0: nada pode entrar durante a pintura
+  uint32_t irq = save_and_disable_interrupts();
+  paintStack(&__StackBottom, sp - STACK_PAINT_MARGIN_WORDS);
+  restore_interrupts(irq);
+
+#if PATROSUM_DUAL_CORE
+  paintStack(&__StackOneBottom, &__StackOneTop); // O core 1 ainda não foi iniciado
+#endif
+
+  lastReport = get_absolute_time();
+}
+
+/**
+ * @brief Heap bytes in use, without counting the lock calls of mallinfo() itself.
+ */
+static uint32_t heapInUse(void)
+{
+  uint32_t before = heapCalls;
+  uint32_t inUse = (uint32_t)mallinfo().uordblks;
+  heapCallsAtSeal += heapCalls - before;
+  return inUse;
+}
+
+void memoryGuardSeal(void)
+{
+  heapInUseAtSeal = heapInUse();
+  heapCallsAtSeal = heapCalls;
+  sealed = true;
+}
+
+void memoryGuardReport(void)
+{
+  absolute_time_t now = get_absolute_time();
+  if (absolute_time_diff_us(lastReport, now) < (int64_t)MEMORY_REPORT_MS * 1000)
+    return;
+  lastReport = now;
+
+  uint32_t stack[2] = {stackPeak(&__StackBottom, &__StackTop), 0};
+#if PATROSUM_DUAL_CORE
+  stack[1] = stackPeak(&__StackOneBottom, &__StackOneTop);
+#endif
+  uint32_t inUse = heapInUse();
+  uint32_t calls = sealed ? heapCalls - heapCallsAtSeal : 0;
+  if (stack[0] == reportedStack[0] && stack[1] == reportedStack[1] && inUse == reportedInUse && calls == reportedCalls)
+    return;
+  reportedStack[0] = stack[0];
+  reportedStack[1] = stack[1];
+  reportedInUse = inUse;
+  reportedCalls = calls;
+
+  uint32_t size0 = (uint32_t)((&__StackTop - &__StackBottom) * sizeof(uint32_t));
+  printf("[memoria] pilha core 0: %lu de %lu bytes%s\n", (unsigned long)stack[0], (unsigned long)size0,
+         stack[0] >= size0 ? " (ESTOURO)" : "");
+#if PATROSUM_DUAL_CORE
+  uint32_t size1 = (uint32_t)((&__StackOneTop - &__StackOneBottom) * sizeof(uint32_t));
+  printf("[memoria] pilha core 1: %lu de %lu bytes%s\n", (unsigned long)stack[1], (unsigned long)size1,
+         stack[1] >= size1 ? " (ESTOURO)" : "");
+#endif
+  printf("[memoria] heap: %lu bytes em uso (%lu no fim do setup) de %lu\n",
+         (unsigned long)inUse, (unsigned long)heapInUseAtSeal, (unsigned long)(&__HeapLimit - &__end__));
+  if (calls)
+    printf("[memoria] ATENCAO: %lu chamadas ao heap depois do setup\n", (unsigned long)calls);
+}
@@ -0,0 +1,58 @@
+/**
+ * @file memory_guard.h
+ * @brief Stack high-water marks and heap use after setup (debug builds only).
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Every buffer of the game (framebuffer, key queue, tone queue, telemetry
+ * ring, flash log) is statically sized, so once setup() returns nothing
+ * should touch the heap again. This monitor checks that on the device:
+ * memoryGuardInit() fills the unused part of both stacks with a pattern,
+ * memoryGuardSeal() marks the end of setup, and memoryGuardReport() prints
+ * over stdio how deep each stack has gone and how many heap calls happened
+ * after the seal, whether from the game or from a library.
+ *
+ * Without PATROSUM_MEMORY_GUARD the MEMORY_GUARD_* macros expand to nothing
+ * and memory_guard.c is not built.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef MEMORY_GUARD_H
+#define MEMORY_GUARD_H
+
+#if PATROSUM_MEMORY_GUARD
+
+#ifndef MEMORY_REPORT_MS
+#define MEMORY_REPORT_MS 5000
+#endif
+
+/**
+ * @brief Paints the free part of the core 0 stack and the whole core 1 stack.
+ * Must run before core 1 is launched.
+ */
+void memoryGuardInit(void);
+
+/**
+ * @brief Marks the end of setup: heap calls from here on are counted.
+ */
+void memoryGuardSeal(void);
+
+/**
+ * @brief Prints stack peaks and heap use if MEMORY_REPORT_MS passed and something grew.
+ */
+void memoryGuardReport(void);
+
+#define MEMORY_GUARD_INIT() memoryGuardInit()
+#define MEMORY_GUARD_SEAL() memoryGuardSeal()
+#define MEMORY_GUARD_REPORT() memoryGuardReport()
+
+#else
+
+#define MEMORY_GUARD_INIT() ((void)0)
+#define MEMORY_GUARD_SEAL() ((void)0)
+#define MEMORY_GUARD_REPORT() ((void)0)
+
+#endif // PATROSUM_MEMORY_GUARD
+
+#endif // MEMORY_GUARD_H
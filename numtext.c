@@ -0,0 +1,74 @@
+/**
+ * @file numtext.c
+ * @brief Lookup-table integer formatting and incremental number entry.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "numtext.h"
+
+#include <string.h>
+
+// "00" "01" ... "99": dois dígitos por consulta
+static const char digitPairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+uint8_t formatNumber(char *out, uint16_t value)
+{
+  char buf[FORMAT_NUMBER_SIZE - 1];
+  int pos = sizeof(buf);
+
+  // Do fim para o começo, dois dígitos por vez
+  uint32_t v = value;
+  while (v >= 100)
+  {
+    uint32_t q = v / 100; // No RP2040 a divisão vai para o divisor do SIO
+    uint32_t r = v - q * 100;
+    pos -= 2;
+    memcpy(&buf[pos], &digitPairs[r * 2], 2);
+    v = q;
+  }
+  if (v >= 10)
+  {
+    pos -= 2;
+    memcpy(&buf[pos], &digitPairs[v * 2], 2);
+  }
+  else
+  {
+    buf[--pos] = (char)('0' + v);
+  }
+
+  uint8_t len = (uint8_t)(sizeof(buf) - pos);
+  memcpy(out, &buf[pos], len);
+  out[len] = '\0';
+  return len;
+}
+
+void numberInputClear(NumberInput *input)
+{
+  input->value = 0;
+  input->digits = 0;
+  input->text[0] = '\0';
+}
+
+bool numberInputAppend(NumberInput *input, uint8_t digit)
+{
+  if (input->digits >= NUMBER_INPUT_MAX_DIGITS)
+    return false;
+
+  input->value = (uint16_t)(input->value * 10 + digit);
+  input->text[input->digits++] = (char)('0' + digit);
+  input->text[input->digits] = '\0';
+  return true;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file numtext.h
+ * @brief Integer formatting and digit-by-digit number entry without stdio.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Replaces sprintf("%d") and atoi() on the game's hot paths. Formatting goes
+ * two digits at a time through a lookup table, so a 4-digit number costs a
+ * single division (done by the RP2040's SIO divider). A NumberInput keeps the
+ * value, the digit count and the text side by side, so checking an answer or
+ * measuring it never scans a string.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef NUMTEXT_H
+#define NUMTEXT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Dígitos de uma resposta (a maior soma é 999 + 999 = 1998). */
+#define NUMBER_INPUT_MAX_DIGITS 4
+
+/** Tamanho de buffer que comporta qualquer uint16_t formatado, com o terminador. */
+#define FORMAT_NUMBER_SIZE 6
+
+/**
+ * @brief A number being typed one digit at a time.
+ */
+typedef struct
+{
+  uint16_t value;                        // Valor dos dígitos digitados
+  uint8_t digits;                        // Quantidade de dígitos (0 = vazio)
+  char text[NUMBER_INPUT_MAX_DIGITS + 1]; // Os mesmos dígitos, prontos para desenhar
+} NumberInput;
+
+/**
+ * @brief Writes value in decimal followed by a terminator.
+ * @param out At least FORMAT_NUMBER_SIZE bytes
+ * @return Number of digits written
+ */
+uint8_t formatNumber(char *out, uint16_t value);
+
+/**
+ * @brief Empties the input.
+ */
+void numberInputClear(NumberInput *input);
+
+/**
+ * @brief Appends a digit (0-9).
+ * @return false if the input is already full
+ */
+bool numberInputAppend(NumberInput *input, uint8_t digit);
+
+#endif // NUMTEXT_H
@@ -0,0 +1,232 @@
+/**
+ * @file oled.c
+ * @brief SSD1306 driver with dirty page tracking; the bus is in oled_i2c.c or oled_spi.c.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "oled.h"
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "oled_bus.h"
+#include "oled_window.h"
+
+#if PATROSUM_OLED_SPI
+#define OLED_BUS_HZ OLED_SPI_BAUDRATE
+#else
+#define OLED_BUS_HZ OLED_I2C_BAUDRATE
+#endif
+
+uint8_t oledBuffer[OLED_PAGES][OLED_WIDTH] __attribute__((aligned(4)));
+
+// Cópia do que está no painel, usada para detectar mudanças
+static uint8_t panelBuffer[OLED_PAGES][OLED_WIDTH] __attribute__((aligned(4)));
+static bool forceFullUpdate = true;
+static OledStats stats;
+static uint32_t busHz = 0;
+
+#if OLED_HEIGHT != 64 && OLED_HEIGHT != 32
+#error "OLED_HEIGHT must be 64 or 32"
+#endif
+
+static const uint8_t initSequence[] = {
+    0xAE,       // Display off
+    0xD5, 0x80, // Clock divide ratio / oscillator
+    0xA8, OLED_HEIGHT - 1, // Multiplex ratio: uma linha por pixel
+    0xD3, 0x00, // Display offset
+    0x40,       // Start line 0
+    0x8D, 0x14, // Charge pump on
+    0x20, 0x00, // Horizontal addressing mode
+    0xA1,       // Segment remap (coluna 127 = SEG0)
+    0xC8,       // COM scan decrescente
+    0xDA, OLED_HEIGHT == 64 ? 0x12 : 0x02, // COM pins: alternados no 128x64, sequenciais no 128x32
+    0x81, 0xCF, // Contraste (OLED_DEFAULT_CONTRAST)
+    0xD9, 0xF1, // Pre-charge
+    0xDB, 0x40, // VCOMH
+    0xA4,       // Exibe o conteúdo da RAM
+    0xA6,       // Normal (não invertido)
+    0x2E,       // Desativa scroll
+    0xAF,       // Display on
+};
+
+// Acesso por palavra às páginas sem violar o aliasing estrito
+typedef uint32_t __attribute__((may_alias)) oled_word_t;
+
+/**
+ * @brief Compares one page of both buffers, four columns at a time.
+ * Replaces memcmp, which lives in flash, on the path that runs every frame.
+ */
+static bool __not_in_flash_func(pageEqual)(const uint8_t *a, const uint8_t *b)
+{
+  const oled_word_t *wa = (const oled_word_t *)a;
+  const oled_word_t *wb = (const oled_word_t *)b;
+  for (int i = 0; i < OLED_WIDTH / 4; i++)
+  {
+    if (wa[i] != wb[i])
+      return false;
+  }
+  return true;
+}
+
+void oledInit(void)
+{
+  busHz = oledBusInit(OLED_BUS_HZ);
+
+  // A sequência inteira vai numa transação; sem ACK acima do fast mode, tenta de novo a 400 kHz
+  if (!oledBusCommands(initSequence, sizeof(initSequence)) && busHz > OLED_SAFE_BAUDRATE)
+  {
+    busHz = oledBusSetClock(OLED_SAFE_BAUDRATE);
+    oledBusCommands(initSequence, sizeof(initSequence));
+  }
+
+  memset(&stats, 0, sizeof(stats));
+  oledClear();
+  oledInvalidate(); // O primeiro envio manda o quadro inteiro, seja ele qual for
+}
+
+void oledClear(void)
+{
+  memset(oledBuffer, 0, sizeof(oledBuffer));
+}
+
+void oledInvalidate(void)
+{
+  forceFullUpdate = true;
+}
+
+bool __not_in_flash_func(oledShowPagesAsync)(uint8_t pageMask, OledFlushCallback onComplete)
+{
+  if (oledBusy())
+    return false; // O quadro fica pendente: a próxima chamada compara de novo com o painel
+
+  OledSpan spans[OLED_PAGES];
+  stats.frames++;
+
+  for (uint8_t page = 0; page < OLED_PAGES; page++)
+  {
+    const uint8_t *next = oledBuffer[page];
+    const uint8_t *prev = panelBuffer[page];
+    spans[page] = OLED_SPAN_NONE;
+
+    if (forceFullUpdate)
+    {
+      spans[page] = (OledSpan){0, OLED_WIDTH - 1};
+      continue;
+    }
+
+    if (!(pageMask & (1u << page)))
+      continue; // Ninguém desenhou nessa página: nem compara
+
+    if (pageEqual(next, prev))
+      continue; // Página igual à do painel
+
+    // Só o trecho entre a primeira e a última coluna alterada
+    uint8_t first = 0;
+    while (next[first] == prev[first])
+      first++;
+    uint8_t last = OLED_WIDTH - 1;
+    while (next[last] == prev[last])
+      last--;
+    spans[page] = (OledSpan){first, last};
+  }
+  forceFullUpdate = false;
+
+  // Trechos próximos saem numa janela só (endereçamento uma vez), se isso poupa bytes no barramento
+  OledWindow windows[OLED_PAGES];
+  uint8_t count = oledPlanWindows(spans, oledBusWindowCost(), oledBusSingleWindow(), windows);
+  if (count == 0)
+  {
+    stats.framesSkipped++;
+    if (onComplete)
+      onComplete();
+    return true;
+  }
+
+  for (uint8_t i = 0; i < count; i++)
+  {
+    const OledWindow *w = &windows[i];
+    size_t len = (size_t)(w->lastCol - w->firstCol) + 1;
+    for (uint8_t page = w->firstPage; page <= w->lastPage; page++)
+      memcpy(&panelBuffer[page][w->firstCol], &oledBuffer[page][w->firstCol], len);
+    stats.pagesSent += (uint32_t)(w->lastPage - w->firstPage) + 1;
+    stats.bytesSent += oledWindowBytes(w);
+  }
+  stats.windowsSent += count;
+
+  oledBusStartFlush(windows, count, onComplete);
+  return true;
+}
+
+bool __not_in_flash_func(oledShowAsync)(OledFlushCallback onComplete)
+{
+  return oledShowPagesAsync(OLED_ALL_PAGES, onComplete);
+}
+
+bool __not_in_flash_func(oledBusy)(void)
+{
+  return oledBusBusy();
+}
+
+void oledWaitIdle(void)
+{
+  while (oledBusy())
+    tight_loop_contents();
+}
+
+void oledShow(void)
+{
+  oledWaitIdle();
+  oledShowAsync(NULL);
+  oledWaitIdle();
+}
+
+void oledSetContrast(uint8_t contrast)
+{
+  const uint8_t cmds[] = {0x81, contrast};
+  oledWaitIdle();
+  oledBusCommands(cmds, sizeof(cmds));
+}
+
+void oledSetPower(bool on)
+{
+  const uint8_t cmd = on ? 0xAF : 0xAE; // Display on / off (a RAM do painel é mantida)
+  oledWaitIdle();
+  oledBusCommands(&cmd, 1);
+}
+
+void oledSetInverted(bool inverted)
+{
+  const uint8_t cmd = inverted ? 0xA7 : 0xA6; // Inverse / normal display
+  oledWaitIdle();
+  oledBusCommands(&cmd, 1);
+}
+
+uint32_t oledSetBusClock(uint32_t hz)
+{
+  static const uint8_t nop = 0xE3; // Comando sem efeito: só confere o ACK no clock novo
+
+  oledWaitIdle();
+  uint32_t previous = busHz;
+  uint32_t actual = oledBusSetClock(hz);
+  if (!oledBusCommands(&nop, 1))
+  {
+    busHz = oledBusSetClock(previous);
+    return 0;
+  }
+  busHz = actual;
+  return actual;
+}
+
+uint32_t oledGetBusClock(void)
+{
+  return busHz;
+}
+
+const OledStats *oledGetStats(void)
+{
+  return &stats;
+}
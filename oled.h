@@ -0,0 +1,165 @@
+/**
+ * @file oled.h
+ * @brief SSD1306 framebuffer with incremental (dirty page) and DMA updates.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The framebuffer uses the SSD1306 page layout: 8 pages of 128 bytes, each
+ * byte holding 8 vertical pixels (LSB on top). oledShow() compares each page
+ * with the copy that was last sent to the panel and only transfers the
+ * changed column span, so redrawing an identical frame costs no bus traffic.
+ *
+ * oledShowAsync() groups those spans into as few addressing windows as
+ * saves bus bytes (a full frame is one window) and a DMA channel streams
+ * them to the bus, I2C by default or 4-wire SPI with PATROSUM_OLED_SPI. The
+ * stream is a separate buffer, so the game can start drawing the next frame
+ * as soon as the call returns.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef OLED_H
+#define OLED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "board.h"
+
+#define OLED_PAGES (OLED_HEIGHT / 8)
+#define OLED_ALL_PAGES ((uint8_t)((1u << OLED_PAGES) - 1)) // Máscara com todas as páginas
+
+/** Clock do I2C: até 1 MHz (fast-mode plus), fora da especificação do SSD1306 mas aceito
+ * pela maioria dos painéis. Sem ACK na inicialização, o driver volta a OLED_SAFE_BAUDRATE. */
+#ifndef OLED_I2C_BAUDRATE
+#define OLED_I2C_BAUDRATE 400000
+#endif
+#define OLED_SAFE_BAUDRATE 400000
+
+#ifndef OLED_SPI_BAUDRATE
+#define OLED_SPI_BAUDRATE 10000000 // Máximo do SSD1306 (ciclo de 100 ns)
+#endif
+
+/** Contraste normal e o da tela de espera (0x00 a 0xFF). */
+#define OLED_DEFAULT_CONTRAST 0xCF
+#ifndef OLED_DIM_CONTRAST
+#define OLED_DIM_CONTRAST 0x08
+#endif
+
+/**
+ * @brief Transfer counters, useful to check how much the dirty tracking saves.
+ */
+typedef struct
+{
+  uint32_t frames;        // Chamadas a oledShow()
+  uint32_t framesSkipped; // Quadros sem nenhuma mudança
+  uint32_t pagesSent;     // Páginas transferidas
+  uint32_t bytesSent;     // Bytes de dados (sem contar comandos)
+  uint32_t windowsSent;   // Janelas de endereçamento (um par de transações I2C cada)
+} OledStats;
+
+/** Called when an asynchronous flush has been handed to the bus (IRQ context). */
+typedef void (*OledFlushCallback)(void);
+
+/** Framebuffer being drawn into (page layout, word aligned). */
+extern uint8_t oledBuffer[OLED_PAGES][OLED_WIDTH];
+
+/**
+ * @brief Initializes the bus and the SSD1306 controller and clears the framebuffer.
+ * Nothing is drawn yet: the next oledShow() or oledShowAsync() sends the whole
+ * frame, so the first thing on the panel can be the boot screen instead of a
+ * blank frame. On I2C the init sequence is checked for an acknowledge; if the
+ * panel does not answer at OLED_I2C_BAUDRATE the clock falls back to 400 kHz.
+ */
+void oledInit(void);
+
+/**
+ * @brief Clears the framebuffer (does not touch the panel).
+ */
+void oledClear(void);
+
+/**
+ * @brief Sends the parts of the framebuffer that changed since the last call
+ * and waits for the transfer to finish.
+ */
+void oledShow(void);
+
+/**
+ * @brief Starts sending the changed parts of the framebuffer in the background.
+ *
+ * The framebuffer may be modified as soon as this returns. If the previous
+ * flush is still running, nothing is sent and false is returned; the changes
+ * are picked up by the next call because the diff is against the panel.
+ *
+ * @param onComplete Optional callback, run from the DMA IRQ when the last byte
+ *                   has been queued (or immediately if nothing changed)
+ * @return true if the frame was accepted
+ */
+bool oledShowAsync(OledFlushCallback onComplete);
+
+/**
+ * @brief Same as oledShowAsync(), comparing only the pages in pageMask.
+ *
+ * For callers that know where they drew (hud.h): the other pages are taken
+ * as unchanged without being compared. If false is returned, retry with
+ * the same pages or more.
+ *
+ * @param pageMask Bit n set = page n may have changed
+ */
+bool oledShowPagesAsync(uint8_t pageMask, OledFlushCallback onComplete);
+
+/**
+ * @brief Returns true while a flush is still on the bus.
+ */
+bool oledBusy(void);
+
+/**
+ * @brief Blocks until the current flush (if any) has finished.
+ */
+void oledWaitIdle(void);
+
+/**
+ * @brief Forces the next oledShow() to resend the whole framebuffer.
+ */
+void oledInvalidate(void);
+
+/**
+ * @brief Sets the panel contrast (brightness). Waits for any pending flush.
+ */
+void oledSetContrast(uint8_t contrast);
+
+/**
+ * @brief Turns the panel on or off (sleep mode, RAM is kept).
+ * Waits for any pending flush.
+ */
+void oledSetPower(bool on);
+
+/**
+ * @brief Shows the panel inverted (lit pixels dark and vice versa).
+ * The framebuffer is untouched. Waits for any pending flush.
+ */
+void oledSetInverted(bool inverted);
+
+/**
+ * @brief Changes the bus clock and checks that the panel still answers.
+ * @return Clock actually in use, or 0 if the panel stopped acknowledging
+ * (the previous clock is restored)
+ */
+uint32_t oledSetBusClock(uint32_t hz);
+
+/**
+ * @brief Bus clock in use, in Hz.
+ */
+uint32_t oledGetBusClock(void);
+
+/**
+ * @brief Name of the transport ("I2C" or "SPI"), for reports.
+ */
+const char *oledBusName(void);
+
+/**
+ * @brief Returns the transfer counters accumulated since oledInit().
+ */
+const OledStats *oledGetStats(void);
+
+#endif // OLED_H
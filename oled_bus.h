@@ -0,0 +1,65 @@
+/**
+ * @file oled_bus.h
+ * @brief Transport between oled.c and the SSD1306: I2C or 4-wire SPI.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Internal to the display driver. oled.c tracks what changed and plans the
+ * windows; the transport (oled_i2c.c or oled_spi.c, chosen in CMake with
+ * PATROSUM_OLED_SPI) sends commands and streams the windows by DMA. Each
+ * transport stages the window data in its own buffer, so the framebuffer can
+ * be redrawn as soon as oledBusStartFlush() returns.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef OLED_BUS_H
+#define OLED_BUS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "oled.h"
+#include "oled_window.h"
+
+/**
+ * @brief Sets up the pins, the bus and the DMA channel.
+ * @return Clock actually in use, in Hz
+ */
+uint32_t oledBusInit(uint32_t hz);
+
+/**
+ * @brief Changes the bus clock.
+ * @return Clock actually in use, in Hz
+ */
+uint32_t oledBusSetClock(uint32_t hz);
+
+/**
+ * @brief Sends commands in one blocking transaction. The bus must be idle.
+ * @return false if the panel did not acknowledge them (I2C only)
+ */
+bool oledBusCommands(const uint8_t *cmds, size_t count);
+
+/**
+ * @brief Starts streaming the windows by DMA; the bus must be idle.
+ * @param onComplete Called from the DMA interrupt at the end (may be NULL)
+ */
+void oledBusStartFlush(const OledWindow *windows, uint8_t count, OledFlushCallback onComplete);
+
+/**
+ * @brief Returns true until the last byte has left the bus.
+ */
+bool oledBusBusy(void);
+
+/**
+ * @brief Bus bytes each extra window costs, used to plan the flush.
+ */
+uint16_t oledBusWindowCost(void);
+
+/**
+ * @brief Returns true if the transport takes a single window per flush.
+ */
+bool oledBusSingleWindow(void);
+
+#endif // OLED_BUS_H
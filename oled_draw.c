@@ -0,0 +1,178 @@
+/**
+ * @file oled_draw.c
+ * @brief Drawing primitives and text for the OLED framebuffer.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "oled_draw.h"
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+// Acesso por palavra ao framebuffer de bytes sem violar o aliasing estrito
+typedef uint32_t __attribute__((may_alias)) oled_word_t;
+
+/**
+ * @brief Applies a vertical bit mask to columns [x1, x2) of one page row.
+ *
+ * Full-page spans become a memset. Partial masks are applied four columns
+ * at a time with a replicated 32-bit mask, with byte loops only for the
+ * unaligned head and tail.
+ */
+static void __not_in_flash_func(fillPageSpan)(uint8_t *row, int x1, int x2, uint8_t mask, bool on)
+{
+  if (mask == 0xFF)
+  {
+    memset(&row[x1], on ? 0xFF : 0x00, (size_t)(x2 - x1));
+    return;
+  }
+
+  int x = x1;
+  while (x < x2 && (x & 3))
+  {
+    row[x] = on ? (row[x] | mask) : (row[x] & ~mask);
+    x++;
+  }
+
+  uint32_t wordMask = mask * 0x01010101u;
+  oled_word_t *word = (oled_word_t *)&row[x];
+  for (; x + 4 <= x2; x += 4, word++)
+    *word = on ? (*word | wordMask) : (*word & ~wordMask);
+
+  for (; x < x2; x++)
+    row[x] = on ? (row[x] | mask) : (row[x] & ~mask);
+}
+
+/**
+ * @brief Bits of a page byte covered by rows [y1, y2).
+ */
+static uint8_t __not_in_flash_func(pageMask)(int page, int y1, int y2)
+{
+  int top = y1 - page * 8;
+  int bottom = y2 - page * 8;
+  if (top < 0)
+    top = 0;
+  if (bottom > 8)
+    bottom = 8;
+  return (uint8_t)((0xFFu << top) & (0xFFu >> (8 - bottom)));
+}
+
+void oledSetPixel(int x, int y, bool on)
+{
+  if (x < 0 || x >= OLED_WIDTH || y < 0 || y >= OLED_HEIGHT)
+    return;
+
+  uint8_t mask = 1u << (y & 7);
+  if (on)
+    oledBuffer[y >> 3][x] |= mask;
+  else
+    oledBuffer[y >> 3][x] &= ~mask;
+}
+
+void __not_in_flash_func(oledFillRect)(int x1, int y1, int x2, int y2, bool on)
+{
+  // Recorta para a tela
+  if (x1 < 0)
+    x1 = 0;
+  if (y1 < 0)
+    y1 = 0;
+  if (x2 > OLED_WIDTH)
+    x2 = OLED_WIDTH;
+  if (y2 > OLED_HEIGHT)
+    y2 = OLED_HEIGHT;
+  if (x1 >= x2 || y1 >= y2)
+    return;
+
+  // Uma passada por página: cada byte cobre 8 linhas de uma vez
+  for (int page = y1 >> 3; page <= (y2 - 1) >> 3; page++)
+    fillPageSpan(oledBuffer[page], x1, x2, pageMask(page, y1, y2), on);
+}
+
+void __not_in_flash_func(oledDrawRectangle)(int x1, int y1, int x2, int y2)
+{
+  oledFillRect(x1, y1, x2, y2, true);
+}
+
+void oledDrawHLine(int x1, int x2, int y)
+{
+  oledFillRect(x1, y, x2, y + 1, true);
+}
+
+void oledDrawVLine(int x, int y1, int y2)
+{
+  oledFillRect(x, y1, x + 1, y2, true);
+}
+
+#if OLED_DRAW_REFERENCE
+void oledDrawRectanglePixels(int x1, int y1, int x2, int y2)
+{
+  for (int y = y1; y < y2; y++)
+  {
+    for (int x = x1; x < x2; x++)
+      oledSetPixel(x, y, true);
+  }
+}
+#endif
+
+void __not_in_flash_func(oledBlitTextRows)(uint8_t *upper, uint8_t *lower, int x, int shift, const char *text)
+{
+  for (; *text; text++, x += FONT_CHAR_ADVANCE)
+  {
+    char c = *text;
+    if (c < FONT_FIRST_CHAR || c > FONT_LAST_CHAR)
+      c = '?';
+
+    if (x <= -FONT_GLYPH_WIDTH)
+      continue;
+    if (x >= OLED_WIDTH)
+      break;
+
+    // Cada byte da fonte já é uma coluna de 8 pixels: só desloca para a linha certa
+    const uint8_t *glyph = font5x7[c - FONT_FIRST_CHAR];
+    for (int col = 0; col < FONT_GLYPH_WIDTH; col++)
+    {
+      int px = x + col;
+      if (px < 0 || px >= OLED_WIDTH)
+        continue;
+
+      uint8_t bits = glyph[col];
+      if (upper)
+        upper[px] |= (uint8_t)(bits << shift);
+      if (lower && shift)
+        lower[px] |= (uint8_t)(bits >> (8 - shift));
+    }
+  }
+}
+
+void __not_in_flash_func(oledDrawText)(int x, int y, const char *text)
+{
+  if (y <= -8 || y >= OLED_HEIGHT)
+    return;
+
+  // Com y alinhado à página o glyph cai em um só byte por coluna;
+  // caso contrário ele é dividido entre a página de cima e a de baixo.
+  int page = y >> 3; // Arredonda para baixo também com y negativo
+  int shift = y & 7;
+  uint8_t *upper = page >= 0 ? oledBuffer[page] : NULL;
+  uint8_t *lower = (shift && page + 1 < OLED_PAGES) ? oledBuffer[page + 1] : NULL;
+
+  oledBlitTextRows(upper, lower, x, shift, text);
+}
+
+void __not_in_flash_func(oledDrawTextCentered)(const char *text, int y)
+{
+  oledDrawText((OLED_WIDTH - oledTextWidth(text)) / 2, y, text);
+}
+
+int __not_in_flash_func(oledTextWidth)(const char *text)
+{
+  // Laço próprio: o strlen da newlib fica na flash
+  int len = 0;
+  while (text[len])
+    len++;
+  return len * FONT_CHAR_ADVANCE;
+}
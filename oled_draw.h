@@ -0,0 +1,84 @@
+/**
+ * @file oled_draw.h
+ * @brief Drawing primitives and text for the OLED framebuffer.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Same conventions as the patroLibs draw.h/text.h helpers: rectangles are
+ * given by two corners and filled, text uses a 6 pixel character advance,
+ * and anything outside the screen is clipped.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef OLED_DRAW_H
+#define OLED_DRAW_H
+
+#include <stdbool.h>
+
+#include "oled.h"
+#include "font5x7.h"
+
+/**
+ * @brief Sets or clears a single pixel.
+ */
+void oledSetPixel(int x, int y, bool on);
+
+/**
+ * @brief Fills the rectangle from (x1, y1) up to, but not including, (x2, y2).
+ */
+void oledDrawRectangle(int x1, int y1, int x2, int y2);
+
+/**
+ * @brief Sets (on) or clears (!on) the rectangle [x1, x2) x [y1, y2).
+ *
+ * Works a page at a time: rows covering a whole page are a memset, partial
+ * pages use a 32-bit masked fill over the span.
+ */
+void oledFillRect(int x1, int y1, int x2, int y2, bool on);
+
+/**
+ * @brief Horizontal line over columns [x1, x2) on row y.
+ */
+void oledDrawHLine(int x1, int x2, int y);
+
+/**
+ * @brief Vertical line over rows [y1, y2) on column x.
+ */
+void oledDrawVLine(int x, int y1, int y2);
+
+#if OLED_DRAW_REFERENCE
+/**
+ * @brief Per-pixel rectangle fill, kept only to benchmark the span path.
+ */
+void oledDrawRectanglePixels(int x1, int y1, int x2, int y2);
+#endif
+
+/**
+ * @brief Draws text with its top-left corner at (x, y).
+ *
+ * Glyph columns are OR-ed straight into the page bytes: one byte per column
+ * when y is a multiple of 8, two (shifted) bytes otherwise.
+ */
+void oledDrawText(int x, int y, const char *text);
+
+/**
+ * @brief Low-level text blit into two page rows.
+ *
+ * Draws text starting at column x into `upper` shifted down by `shift` bits,
+ * spilling the remainder into `lower`. Either row may be NULL to clip it.
+ * Used by oledDrawText() and by the text cache to pre-render strings.
+ */
+void oledBlitTextRows(uint8_t *upper, uint8_t *lower, int x, int shift, const char *text);
+
+/**
+ * @brief Draws text horizontally centered on the screen.
+ */
+void oledDrawTextCentered(const char *text, int y);
+
+/**
+ * @brief Width in pixels of a string drawn with oledDrawText().
+ */
+int oledTextWidth(const char *text);
+
+#endif // OLED_DRAW_H
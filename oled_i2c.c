@@ -0,0 +1,180 @@
+/**
+ * @file oled_i2c.c
+ * @brief SSD1306 transport over I2C, with the windows streamed by DMA.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * A window is two transactions: the six addressing commands, then the data
+ * of all its pages in a row (the controller moves to the next page by
+ * itself in horizontal addressing mode). The DMA channel writes 16-bit
+ * words to IC_DATA_CMD, so the STOP bit of the last byte of each
+ * transaction travels in the same stream.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "oled_bus.h"
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+// Bytes de controle do SSD1306
+#define OLED_CONTROL_COMMAND 0x00
+#define OLED_CONTROL_DATA 0x40
+
+// Por janela: controle + 6 comandos de endereçamento e o controle dos dados;
+// os dados de todas as janelas somam no máximo a tela inteira
+#define OLED_WINDOW_COMMANDS 6
+#define OLED_STREAM_WORDS (OLED_PAGES * (1 + OLED_WINDOW_COMMANDS + 1) + OLED_PAGES * OLED_WIDTH)
+
+// Uma janela a mais custa dois endereços de escravo, dois bytes de controle,
+// os 6 comandos e um par STOP/START (cerca de um byte)
+#define OLED_I2C_WINDOW_COST 11
+
+/** Maior transação de comandos: a sequência de inicialização inteira cabe numa só. */
+#define OLED_COMMAND_MAX 32
+
+// Sequência de palavras para o IC_DATA_CMD (byte + bit de STOP), enviada por DMA
+static uint16_t txStream[OLED_STREAM_WORDS];
+static int dmaChannel = -1;
+static volatile bool dmaRunning = false;
+static OledFlushCallback flushCallback = NULL;
+
+static void __not_in_flash_func(oledDmaIrqHandler)(void)
+{
+  if (!dma_channel_get_irq1_status(dmaChannel))
+    return;
+
+  dma_channel_acknowledge_irq1(dmaChannel);
+  dmaRunning = false;
+  if (flushCallback)
+    flushCallback();
+}
+
+uint32_t oledBusInit(uint32_t hz)
+{
+  uint32_t actual = i2c_init(OLED_I2C, hz);
+  gpio_set_function(OLED_SDA_PIN, GPIO_FUNC_I2C);
+  gpio_set_function(OLED_SCL_PIN, GPIO_FUNC_I2C);
+  gpio_pull_up(OLED_SDA_PIN);
+  gpio_pull_up(OLED_SCL_PIN);
+
+  // O DMA escreve direto no IC_DATA_CMD, então o endereço do escravo fica fixo
+  i2c_hw_t *hw = i2c_get_hw(OLED_I2C);
+  hw->enable = 0;
+  hw->tar = OLED_I2C_ADDRESS;
+  hw->enable = 1;
+
+  dmaChannel = dma_claim_unused_channel(true);
+  dma_channel_config cfg = dma_channel_get_default_config(dmaChannel);
+  channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+  channel_config_set_read_increment(&cfg, true);
+  channel_config_set_write_increment(&cfg, false);
+  channel_config_set_dreq(&cfg, i2c_get_dreq(OLED_I2C, true));
+  dma_channel_configure(dmaChannel, &cfg, &hw->data_cmd, txStream, 0, false);
+
+  dma_channel_set_irq1_enabled(dmaChannel, true);
+  irq_add_shared_handler(DMA_IRQ_1, oledDmaIrqHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_1, true);
+
+  return actual;
+}
+
+uint32_t oledBusSetClock(uint32_t hz)
+{
+  return i2c_set_baudrate(OLED_I2C, hz);
+}
+
+bool oledBusCommands(const uint8_t *cmds, size_t count)
+{
+  uint8_t buf[OLED_COMMAND_MAX + 1];
+  buf[0] = OLED_CONTROL_COMMAND;
+
+  while (count > 0)
+  {
+    size_t n = count < OLED_COMMAND_MAX ? count : OLED_COMMAND_MAX;
+    memcpy(&buf[1], cmds, n);
+    // Um NACK (painel ausente, ou sem resposta nesse clock) devolve erro em vez do total
+    if (i2c_write_blocking(OLED_I2C, OLED_I2C_ADDRESS, buf, n + 1, false) != (int)(n + 1))
+      return false;
+    cmds += n;
+    count -= n;
+  }
+  return true;
+}
+
+/**
+ * @brief Appends one I2C transaction to the stream, with STOP on its last byte.
+ * @return Number of words written
+ */
+static size_t __not_in_flash_func(appendTransaction)(uint16_t *out, uint8_t control, const uint8_t *bytes, size_t len)
+{
+  out[0] = control;
+  for (size_t i = 0; i < len; i++)
+    out[i + 1] = bytes[i];
+  out[len] |= I2C_IC_DATA_CMD_STOP_BITS;
+  return len + 1;
+}
+
+/**
+ * @brief Appends a window (addressing, then the data of all its pages) to the stream.
+ * @return Number of words written
+ */
+static size_t __not_in_flash_func(appendWindow)(uint16_t *out, const OledWindow *w)
+{
+  const uint8_t window[OLED_WINDOW_COMMANDS] = {
+      0x21, w->firstCol, w->lastCol,   // Column address
+      0x22, w->firstPage, w->lastPage, // Page address
+  };
+  size_t words = appendTransaction(out, OLED_CONTROL_COMMAND, window, sizeof(window));
+
+  out[words++] = OLED_CONTROL_DATA;
+  for (uint8_t page = w->firstPage; page <= w->lastPage; page++)
+  {
+    const uint8_t *row = oledBuffer[page];
+    for (uint8_t col = w->firstCol; col <= w->lastCol; col++)
+      out[words++] = row[col];
+  }
+  out[words - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+  return words;
+}
+
+void __not_in_flash_func(oledBusStartFlush)(const OledWindow *windows, uint8_t count, OledFlushCallback onComplete)
+{
+  size_t words = 0;
+  for (uint8_t i = 0; i < count; i++)
+    words += appendWindow(&txStream[words], &windows[i]);
+
+  flushCallback = onComplete;
+  dmaRunning = true;
+  dma_channel_transfer_from_buffer_now(dmaChannel, txStream, words);
+}
+
+bool __not_in_flash_func(oledBusBusy)(void)
+{
+  if (dmaRunning)
+    return true;
+
+  // O DMA termina quando o último byte entra na FIFO; espera o barramento esvaziar
+  i2c_hw_t *hw = i2c_get_hw(OLED_I2C);
+  return !(hw->status & I2C_IC_STATUS_TFE_BITS) || (hw->status & I2C_IC_STATUS_ACTIVITY_BITS);
+}
+
+uint16_t __not_in_flash_func(oledBusWindowCost)(void)
+{
+  return OLED_I2C_WINDOW_COST;
+}
+
+bool __not_in_flash_func(oledBusSingleWindow)(void)
+{
+  return false;
+}
+
+const char *oledBusName(void)
+{
+  return "I2C";
+}
@@ -0,0 +1,135 @@
+/**
+ * @file oled_spi.c
+ * @brief SSD1306 transport over 4-wire SPI, with the window streamed by DMA.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * In 4-wire mode the D/C pin, not a control byte, tells commands from data,
+ * and switching it needs the bus idle. So a flush is always a single
+ * window: its six addressing commands go out blocking (under a microsecond
+ * at 10 MHz), then D/C goes high and the DMA streams the data. SPI has no
+ * acknowledge, so commands always report success.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "oled_bus.h"
+
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+// Cópia dos dados da janela: o framebuffer pode ser redesenhado durante o envio
+static uint8_t txStream[OLED_PAGES * OLED_WIDTH];
+static int dmaChannel = -1;
+static volatile bool dmaRunning = false;
+static OledFlushCallback flushCallback = NULL;
+
+static void __not_in_flash_func(oledDmaIrqHandler)(void)
+{
+  if (!dma_channel_get_irq1_status(dmaChannel))
+    return;
+
+  dma_channel_acknowledge_irq1(dmaChannel);
+  dmaRunning = false;
+  if (flushCallback)
+    flushCallback();
+}
+
+static void initOutput(uint pin, bool value)
+{
+  gpio_init(pin);
+  gpio_put(pin, value);
+  gpio_set_dir(pin, GPIO_OUT);
+}
+
+uint32_t oledBusInit(uint32_t hz)
+{
+  uint32_t actual = spi_init(OLED_SPI, hz);
+  spi_set_format(OLED_SPI, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST); // Modo 0 do SSD1306
+  gpio_set_function(OLED_SPI_SCK_PIN, GPIO_FUNC_SPI);
+  gpio_set_function(OLED_SPI_MOSI_PIN, GPIO_FUNC_SPI);
+
+  initOutput(OLED_SPI_CS_PIN, false); // Único dispositivo no barramento: sempre selecionado
+  initOutput(OLED_SPI_DC_PIN, false);
+  initOutput(OLED_SPI_RESET_PIN, true);
+
+  // Reset do controlador (RES# em 0 por pelo menos 3 us)
+  gpio_put(OLED_SPI_RESET_PIN, false);
+  sleep_us(10);
+  gpio_put(OLED_SPI_RESET_PIN, true);
+  sleep_us(10);
+
+  dmaChannel = dma_claim_unused_channel(true);
+  dma_channel_config cfg = dma_channel_get_default_config(dmaChannel);
+  channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+  channel_config_set_read_increment(&cfg, true);
+  channel_config_set_write_increment(&cfg, false);
+  channel_config_set_dreq(&cfg, spi_get_dreq(OLED_SPI, true));
+  dma_channel_configure(dmaChannel, &cfg, &spi_get_hw(OLED_SPI)->dr, txStream, 0, false);
+
+  dma_channel_set_irq1_enabled(dmaChannel, true);
+  irq_add_shared_handler(DMA_IRQ_1, oledDmaIrqHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_1, true);
+
+  return actual;
+}
+
+uint32_t oledBusSetClock(uint32_t hz)
+{
+  return spi_set_baudrate(OLED_SPI, hz);
+}
+
+bool __not_in_flash_func(oledBusCommands)(const uint8_t *cmds, size_t count)
+{
+  gpio_put(OLED_SPI_DC_PIN, false);
+  spi_write_blocking(OLED_SPI, cmds, count); // Só retorna com o último bit fora
+  return true;
+}
+
+void __not_in_flash_func(oledBusStartFlush)(const OledWindow *windows, uint8_t count, OledFlushCallback onComplete)
+{
+  (void)count; // oledBusSingleWindow(): sempre uma janela
+  const OledWindow *w = &windows[0];
+
+  size_t len = 0;
+  for (uint8_t page = w->firstPage; page <= w->lastPage; page++)
+  {
+    const uint8_t *row = oledBuffer[page];
+    for (uint8_t col = w->firstCol; col <= w->lastCol; col++)
+      txStream[len++] = row[col];
+  }
+
+  const uint8_t window[] = {
+      0x21, w->firstCol, w->lastCol,   // Column address
+      0x22, w->firstPage, w->lastPage, // Page address
+  };
+  oledBusCommands(window, sizeof(window));
+  gpio_put(OLED_SPI_DC_PIN, true);
+
+  flushCallback = onComplete;
+  dmaRunning = true;
+  dma_channel_transfer_from_buffer_now(dmaChannel, txStream, len);
+}
+
+bool __not_in_flash_func(oledBusBusy)(void)
+{
+  // O DMA termina quando o último byte entra na FIFO; espera ele sair do registrador
+  return dmaRunning || spi_is_busy(OLED_SPI);
+}
+
+uint16_t __not_in_flash_func(oledBusWindowCost)(void)
+{
+  return 6; // Só os comandos de endereçamento
+}
+
+bool __not_in_flash_func(oledBusSingleWindow)(void)
+{
+  return true;
+}
+
+const char *oledBusName(void)
+{
+  return "SPI";
+}
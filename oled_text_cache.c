@@ -0,0 +1,143 @@
+/**
+ * @file oled_text_cache.c
+ * @brief Cache of pre-rendered static strings for the OLED framebuffer.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "oled_text_cache.h"
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "oled_draw.h"
+
+typedef enum
+{
+  ALIGN_LEFT,
+  ALIGN_CENTER,
+  ALIGN_RIGHT
+} TextAlign;
+
+typedef struct
+{
+  bool used;
+  char text[OLED_TEXT_CACHE_MAX_LEN + 1];
+  uint32_t lastUse;
+
+  // Texto renderizado no topo de uma linha de página (glifos de 7 pixels cabem em 8)
+  uint8_t width;
+  uint8_t strip[OLED_TEXT_CACHE_MAX_LEN * FONT_CHAR_ADVANCE];
+} TextCacheEntry;
+
+static TextCacheEntry cache[OLED_TEXT_CACHE_ENTRIES];
+static uint32_t useCounter = 0;
+
+// Comparação própria: strcmp e strlen da newlib ficam na flash
+static bool __not_in_flash_func(textEqual)(const char *a, const char *b)
+{
+  while (*a && *a == *b)
+  {
+    a++;
+    b++;
+  }
+  return *a == *b;
+}
+
+/**
+ * @brief Renders text into a cache entry's strip. The key is the text
+ * alone: the same label drawn elsewhere (a sliding title) reuses the entry.
+ */
+static void renderEntry(TextCacheEntry *e, const char *text, size_t len)
+{
+  e->used = true;
+  memcpy(e->text, text, len + 1);
+  e->width = (uint8_t)(len * FONT_CHAR_ADVANCE);
+
+  uint8_t row[OLED_WIDTH] = {0};
+  oledBlitTextRows(row, NULL, 0, 0, text);
+  memcpy(e->strip, row, e->width);
+}
+
+/**
+ * @brief ORs the strip into the framebuffer with its left edge at x and its
+ * top at y, shifting it across two pages when y is not a multiple of 8.
+ */
+static void __not_in_flash_func(blitEntry)(const TextCacheEntry *e, int x, int y)
+{
+  int page = y >> 3;
+  int shift = y & 7;
+  uint8_t *upper = page >= 0 ? oledBuffer[page] : NULL;
+  uint8_t *lower = shift && page + 1 < OLED_PAGES ? oledBuffer[page + 1] : NULL;
+
+  // Recorta as colunas para o que cabe na tela
+  int first = x < 0 ? -x : 0;
+  int last = x + e->width > OLED_WIDTH ? OLED_WIDTH - x : e->width;
+  for (int i = first; i < last; i++)
+  {
+    uint8_t column = e->strip[i];
+    if (upper)
+      upper[x + i] |= (uint8_t)(column << shift);
+    if (lower)
+      lower[x + i] |= (uint8_t)(column >> (8 - shift));
+  }
+}
+
+static void __not_in_flash_func(drawCached)(TextAlign align, int x, int y, const char *text)
+{
+  size_t len = (size_t)(oledTextWidth(text) / FONT_CHAR_ADVANCE);
+  if (len > OLED_TEXT_CACHE_MAX_LEN || y <= -8 || y >= OLED_HEIGHT)
+  {
+    if (align == ALIGN_CENTER)
+      oledDrawTextCentered(text, y);
+    else
+      oledDrawText(align == ALIGN_RIGHT ? x - oledTextWidth(text) : x, y, text);
+    return;
+  }
+
+  int width = (int)len * FONT_CHAR_ADVANCE;
+  if (align == ALIGN_CENTER)
+    x = (OLED_WIDTH - width) / 2;
+  else if (align == ALIGN_RIGHT)
+    x -= width;
+
+  TextCacheEntry *victim = &cache[0];
+  for (int i = 0; i < OLED_TEXT_CACHE_ENTRIES; i++)
+  {
+    TextCacheEntry *e = &cache[i];
+    if (e->used && textEqual(e->text, text))
+    {
+      e->lastUse = ++useCounter;
+      blitEntry(e, x, y);
+      return;
+    }
+    if (!e->used || (victim->used && e->lastUse < victim->lastUse))
+      victim = e;
+  }
+
+  renderEntry(victim, text, len);
+  victim->lastUse = ++useCounter;
+  blitEntry(victim, x, y);
+}
+
+void oledDrawTextCached(int x, int y, const char *text)
+{
+  drawCached(ALIGN_LEFT, x, y, text);
+}
+
+void oledDrawTextCenteredCached(const char *text, int y)
+{
+  drawCached(ALIGN_CENTER, 0, y, text);
+}
+
+void oledDrawTextRightCached(int x, int y, const char *text)
+{
+  drawCached(ALIGN_RIGHT, x, y, text);
+}
+
+void oledTextCacheClear(void)
+{
+  memset(cache, 0, sizeof(cache));
+}
@@ -0,0 +1,51 @@
+/**
+ * @file oled_text_cache.h
+ * @brief Cache of pre-rendered static strings for the OLED framebuffer.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Labels such as "Resolva a conta:" or "enviar" are drawn every frame at the
+ * same place. The first draw renders the string once into a page-layout
+ * strip; later draws of the same text, at any position, only shift and OR
+ * that strip into the framebuffer, without touching the font again.
+ *
+ * Use it for text that rarely changes; dynamic strings should keep using
+ * oledDrawText(), which doesn't evict cached labels.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef OLED_TEXT_CACHE_H
+#define OLED_TEXT_CACHE_H
+
+#include "oled.h"
+
+/** Quantidade de textos guardados (substituição do menos usado). */
+#ifndef OLED_TEXT_CACHE_ENTRIES
+#define OLED_TEXT_CACHE_ENTRIES 8
+#endif
+
+/** Tamanho máximo de um texto guardado; textos maiores são desenhados direto. */
+#define OLED_TEXT_CACHE_MAX_LEN 21
+
+/**
+ * @brief Same as oledDrawText(), served from the cache when possible.
+ */
+void oledDrawTextCached(int x, int y, const char *text);
+
+/**
+ * @brief Same as oledDrawTextCentered(), served from the cache when possible.
+ */
+void oledDrawTextCenteredCached(const char *text, int y);
+
+/**
+ * @brief Same as oledDrawText() with the text's right edge at x.
+ */
+void oledDrawTextRightCached(int x, int y, const char *text);
+
+/**
+ * @brief Drops every cached string.
+ */
+void oledTextCacheClear(void);
+
+#endif // OLED_TEXT_CACHE_H
@@ -0,0 +1,85 @@
+/**
+ * @file oled_window.c
+ * @brief Cheapest grouping of changed spans into SSD1306 windows.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "oled_window.h"
+
+#include "pico/stdlib.h"
+
+uint16_t __not_in_flash_func(oledWindowBytes)(const OledWindow *w)
+{
+  return (uint16_t)((w->lastCol - w->firstCol + 1) * (w->lastPage - w->firstPage + 1));
+}
+
+/**
+ * @brief Window covering the changed pages changed[from..to] and the pages between them.
+ */
+static OledWindow __not_in_flash_func(groupWindow)(const OledSpan *spans, const uint8_t *changed, int from, int to)
+{
+  OledWindow w = {OLED_WIDTH - 1, 0, changed[from], changed[to]};
+  for (int i = from; i <= to; i++)
+  {
+    const OledSpan *s = &spans[changed[i]];
+    if (s->first < w.firstCol)
+      w.firstCol = s->first;
+    if (s->last > w.lastCol)
+      w.lastCol = s->last;
+  }
+  return w;
+}
+
+uint8_t __not_in_flash_func(oledPlanWindows)(const OledSpan spans[OLED_PAGES], uint16_t windowCost, bool singleWindow,
+                                             OledWindow *out)
+{
+  uint8_t changed[OLED_PAGES];
+  int count = 0;
+  for (uint8_t page = 0; page < OLED_PAGES; page++)
+  {
+    if (spans[page].first <= spans[page].last)
+      changed[count++] = page;
+  }
+  if (count == 0)
+    return 0;
+
+  if (singleWindow)
+  {
+    out[0] = groupWindow(spans, changed, 0, count - 1);
+    return 1;
+  }
+
+  // cost[k]: menor custo para cobrir as k primeiras páginas alteradas; start[k]: início do último grupo
+  uint32_t cost[OLED_PAGES + 1];
+  uint8_t start[OLED_PAGES + 1];
+  cost[0] = 0;
+  for (int k = 1; k <= count; k++)
+  {
+    cost[k] = UINT32_MAX;
+    for (int j = 0; j < k; j++)
+    {
+      OledWindow w = groupWindow(spans, changed, j, k - 1);
+      uint32_t c = cost[j] + windowCost + oledWindowBytes(&w);
+      if (c < cost[k])
+      {
+        cost[k] = c;
+        start[k] = (uint8_t)j;
+      }
+    }
+  }
+
+  // Refaz os grupos de trás para frente e devolve de cima para baixo
+  uint8_t groups = 0;
+  uint8_t bounds[OLED_PAGES];
+  for (int k = count; k > 0; k = start[k])
+    bounds[groups++] = (uint8_t)k;
+  for (uint8_t g = 0; g < groups; g++)
+  {
+    int k = bounds[groups - 1 - g];
+    out[g] = groupWindow(spans, changed, start[k], k - 1);
+  }
+  return groups;
+}
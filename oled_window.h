@@ -0,0 +1,63 @@
+/**
+ * @file oled_window.h
+ * @brief Grouping of the changed page spans of a flush into bus windows.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The SSD1306 writes data into a window (columns x pages) set by two
+ * commands, wrapping to the next page at the right edge. Every window costs
+ * a command transaction on the bus, so a flush whose changed spans are
+ * close together is cheaper as one window that also resends the unchanged
+ * bytes between them. oledPlanWindows() picks the cheapest grouping of
+ * consecutive pages; with eight pages that is a tiny dynamic program.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef OLED_WINDOW_H
+#define OLED_WINDOW_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "oled.h"
+
+/**
+ * @brief Changed columns [first, last] of one page; first > last = unchanged.
+ */
+typedef struct
+{
+  uint8_t first;
+  uint8_t last;
+} OledSpan;
+
+/**
+ * @brief Rectangle sent with one addressing command: columns x pages, inclusive.
+ */
+typedef struct
+{
+  uint8_t firstCol;
+  uint8_t lastCol;
+  uint8_t firstPage;
+  uint8_t lastPage;
+} OledWindow;
+
+/** Span de uma página sem mudanças. */
+#define OLED_SPAN_NONE ((OledSpan){1, 0})
+
+/**
+ * @brief Groups the changed spans into windows with the fewest bus bytes.
+ * @param spans One span per page
+ * @param windowCost Bus bytes spent on each extra window (commands, addressing)
+ * @param singleWindow Transport that takes a single window per flush
+ * @param out Up to OLED_PAGES windows, top to bottom
+ * @return Number of windows (0 if nothing changed)
+ */
+uint8_t oledPlanWindows(const OledSpan spans[OLED_PAGES], uint16_t windowCost, bool singleWindow, OledWindow *out);
+
+/**
+ * @brief Data bytes covered by a window.
+ */
+uint16_t oledWindowBytes(const OledWindow *w);
+
+#endif // OLED_WINDOW_H
@@ -0,0 +1,31 @@
+/**
+ * @file player.c
+ * @brief Per-player score keeping.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "player.h"
+
+void playerScoreReset(PlayerScore *score)
+{
+  score->correct = 0;
+  score->answered = 0;
+  score->streak = 0;
+}
+
+void playerScoreRecord(PlayerScore *score, bool correct)
+{
+  score->answered++;
+  if (correct)
+  {
+    score->correct++;
+    score->streak++;
+  }
+  else
+  {
+    score->streak = 0;
+  }
+}
@@ -0,0 +1,41 @@
+/**
+ * @file player.h
+ * @brief Per-player scores of the hot-seat mode.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Up to MAX_PLAYERS share the board and take turns: each question belongs
+ * to one player, who types into their own answer and scores on their own.
+ * Holding '*' and pressing a digit from 1 to MAX_PLAYERS sets how many play
+ * (1 = the solo game). Scores live in RAM and restart when the count changes.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef PLAYER_H
+#define PLAYER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Jogadores que cabem na tela de resultado, uma linha por jogador. */
+#define MAX_PLAYERS 4
+
+typedef struct
+{
+  uint16_t correct;  // Acertos
+  uint16_t answered; // Respostas enviadas
+  uint16_t streak;   // Acertos seguidos
+} PlayerScore;
+
+/**
+ * @brief Starts an empty score.
+ */
+void playerScoreReset(PlayerScore *score);
+
+/**
+ * @brief Adds one answer.
+ */
+void playerScoreRecord(PlayerScore *score, bool correct);
+
+#endif // PLAYER_H
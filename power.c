@@ -0,0 +1,187 @@
+/**
+ * @file power.c
+ * @brief Attract screen and sleep timeouts, WFI and dormant idle.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "power.h"
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "game.h"
+#include "keypad_events.h"
+#include "led_effects.h"
+#include "tone_sequencer.h"
+#include "render.h"
+#include "stats_store.h"
+
+#if PATROSUM_AUDIO_PCM
+#include "audio.h"
+#endif
+
+#if PATROSUM_TELEMETRY
+#include "telemetry.h"
+#endif
+
+#if PATROSUM_DORMANT
+#include "hardware/clocks.h"
+#include "hardware/pll.h"
+#include "hardware/xosc.h"
+#endif
+
+static PowerMode mode = POWER_ACTIVE;
+static uint32_t wokeAtUs = 0; // Acordar também conta como atividade
+static absolute_time_t ignoreKeysUntil;
+
+/**
+ * @brief Time since the last key or the last wake-up, whichever is newer.
+ */
+static uint32_t idleUs(void)
+{
+  uint32_t now = time_us_32();
+  uint32_t sinceKey = now - keypadLastEventUs();
+  uint32_t sinceWake = now - wokeAtUs;
+  return sinceKey < sinceWake ? sinceKey : sinceWake;
+}
+
+/**
+ * @brief Discards the pending keys; a release among them must not leave the game holding the key.
+ */
+static void flushKeys(void)
+{
+  keypadFlushEvents();
+  gameForgetHeldKeys();
+}
+
+static void wakeUp(void)
+{
+  mode = POWER_ACTIVE;
+  wokeAtUs = time_us_32();
+  ignoreKeysUntil = make_timeout_time_ms(POWER_WAKE_IGNORE_MS);
+  flushKeys();
+}
+
+void powerInit(void)
+{
+  mode = POWER_ACTIVE;
+  wokeAtUs = time_us_32();
+  ignoreKeysUntil = nil_time;
+}
+
+PowerMode powerUpdate(GameState state)
+{
+  if (!time_reached(ignoreKeysUntil))
+    flushKeys(); // Descarta a tecla que acordou o jogo (e a sua trepidação)
+
+  uint32_t idle = idleUs();
+
+  switch (mode)
+  {
+  case POWER_ACTIVE:
+    if (state == WAITING_FOR_INPUT && idle >= PATROSUM_ATTRACT_TIMEOUT_MS * 1000u)
+    {
+      mode = POWER_ATTRACT;
+      statsStorePrepare(); // Ninguém joga: a hora de apagar o próximo setor do log
+    }
+    break;
+  case POWER_ATTRACT:
+    if (idle < PATROSUM_ATTRACT_TIMEOUT_MS * 1000u)
+      wakeUp(); // Chegou uma tecla
+    else if (idle >= PATROSUM_SLEEP_TIMEOUT_MS * 1000u)
+      mode = POWER_SLEEP;
+    break;
+  case POWER_SLEEP:
+    break; // Sai por powerSleep()
+  }
+
+  return mode;
+}
+
+#if PATROSUM_DORMANT
+/**
+ * @brief Stops every clock until a keypad column goes low, then restores them.
+ */
+static void dormantUntilKey(void)
+{
+  static const uint8_t colPins[KEYPAD_COLS] = KEYPAD_COL_PINS;
+
+  // Tudo passa a rodar do cristal, que é o que o modo dormant desliga
+  clock_configure(clk_ref, CLOCKS_CLK_REF_CTRL_SRC_VALUE_XOSC_CLKSRC, 0, XOSC_HZ, XOSC_HZ);
+  clock_configure(clk_sys, CLOCKS_CLK_SYS_CTRL_SRC_VALUE_CLK_REF, 0, XOSC_HZ, XOSC_HZ);
+  clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_XOSC_CLKSRC, XOSC_HZ, XOSC_HZ);
+  clock_stop(clk_usb);
+  clock_stop(clk_adc);
+  clock_stop(clk_rtc);
+  pll_deinit(pll_sys);
+  pll_deinit(pll_usb);
+
+  for (int c = 0; c < KEYPAD_COLS; c++)
+    gpio_set_dormant_irq_enabled(colPins[c], GPIO_IRQ_EDGE_FALL, true);
+
+  xosc_dormant(); // Para aqui até uma coluna descer
+
+  for (int c = 0; c < KEYPAD_COLS; c++)
+  {
+    gpio_set_dormant_irq_enabled(colPins[c], GPIO_IRQ_EDGE_FALL, false);
+    gpio_acknowledge_irq(colPins[c], GPIO_IRQ_EDGE_FALL);
+  }
+
+  // Refaz os PLLs e os clocks como no boot
+  pll_init(pll_usb, PLL_USB_REFDIV, PLL_USB_VCO_FREQ_HZ, PLL_USB_POSTDIV1, PLL_USB_POSTDIV2);
+  clock_configure(clk_usb, 0, CLOCKS_CLK_USB_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB, 48 * MHZ, 48 * MHZ);
+  clock_configure(clk_adc, 0, CLOCKS_CLK_ADC_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB, 48 * MHZ, 48 * MHZ);
+  clock_configure(clk_rtc, 0, CLOCKS_CLK_RTC_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB, 48 * MHZ, 46875);
+  set_sys_clock_khz(SYS_CLK_KHZ, true); // pll_sys, clk_sys e clk_peri
+}
+#endif
+
+void powerSleep(void)
+{
+#if PATROSUM_DUAL_CORE
+  // O core 1 desliga o painel e os LEDs antes de parar
+  while (!renderIsParked())
+    tight_loop_contents();
+#endif
+
+  // Grava o que ficou pendente: o jogo pode ficar dormindo até alguém desligar a placa
+  statsStoreFlush();
+
+  // Nenhum timer periódico pode ficar ativo, senão ele acorda a CPU
+  stopTones();
+#if PATROSUM_AUDIO_PCM
+  while (audioIsActive()) // O DMA de áudio termina o fade (no máximo dois blocos)
+    tight_loop_contents();
+#endif
+  ledEffectsSuspend();
+  keypadSuspend();
+#if PATROSUM_TELEMETRY
+  telemetrySuspend(); // Associado, o rádio gastaria energia e acordaria a CPU
+#endif
+
+#if PATROSUM_DORMANT
+  dormantUntilKey();
+#else
+  // Com as interrupções mascaradas o WFI ainda acorda, mas o handler só roda
+  // depois do teste: uma tecla entre o teste e o WFI não se perde.
+  // O alarme de 1 ms do stdio_usb continua ativo (pará-lo derrubaria a serial):
+  // com a USB ligada o laço acorda a cada milissegundo e volta ao WFI
+  uint32_t irq = save_and_disable_interrupts();
+  while (!keypadWakePending())
+  {
+    __wfi();
+    restore_interrupts(irq);
+    irq = save_and_disable_interrupts();
+  }
+  restore_interrupts(irq);
+#endif
+
+#if PATROSUM_TELEMETRY
+  telemetryResume();
+#endif
+  keypadResume();
+  ledEffectsResume();
+  wakeUp();
+}
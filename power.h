@@ -0,0 +1,70 @@
+/**
+ * @file power.h
+ * @brief Idle detection and low-power modes for the game loop.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Between frames both loops already sleep in sleep_until() (WFE until the
+ * next alarm). On top of that, after PATROSUM_ATTRACT_TIMEOUT_MS without a
+ * key the game switches to a dimmed attract screen with the LEDs off, and
+ * after PATROSUM_SLEEP_TIMEOUT_MS it turns the panel off, stops every
+ * periodic timer and waits for a key in __wfi(). With PATROSUM_DORMANT the
+ * RP2040 goes dormant instead (all clocks stopped, woken by the keypad
+ * columns), at the cost of dropping the USB connection.
+ *
+ * The mode is published in the game snapshot so the render pipeline can
+ * follow it. Only core 0 calls these functions.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef POWER_H
+#define POWER_H
+
+#include "game_snapshot.h"
+
+/** Tempo sem teclas até a tela de espera (configurável no CMake). */
+#ifndef PATROSUM_ATTRACT_TIMEOUT_MS
+#define PATROSUM_ATTRACT_TIMEOUT_MS 60000
+#endif
+
+/**
+ * Tempo sem teclas até desligar o painel e dormir, contado da última tecla.
+ * Deve ser maior que PATROSUM_ATTRACT_TIMEOUT_MS e menor que ~70 minutos
+ * (o tempo ocioso é medido com time_us_32()).
+ */
+#ifndef PATROSUM_SLEEP_TIMEOUT_MS
+#define PATROSUM_SLEEP_TIMEOUT_MS 300000
+#endif
+
+/** Depois de acordar, teclas são descartadas por este tempo (a tecla que acordou não vale). */
+#ifndef POWER_WAKE_IGNORE_MS
+#define POWER_WAKE_IGNORE_MS 150
+#endif
+
+/**
+ * @brief Starts counting idle time from now. Call after initKeypadEvents().
+ */
+void powerInit(void);
+
+/**
+ * @brief Checks the idle timeouts and returns the mode for this iteration.
+ *
+ * The attract screen is only entered while the game waits for an answer;
+ * any key (which is discarded) brings the game back.
+ *
+ * @param state Current game state
+ */
+PowerMode powerUpdate(GameState state);
+
+/**
+ * @brief Sleeps until a key is pressed. Call after publishing a POWER_SLEEP
+ * snapshot; when it returns the mode is POWER_ACTIVE again.
+ *
+ * Without PATROSUM_DORMANT the sleep is not tickless in USB stdio builds:
+ * the SDK's stdio_usb background task keeps its 1 ms alarm, so the core
+ * wakes from WFI every millisecond and goes straight back to sleep.
+ */
+void powerSleep(void);
+
+#endif // POWER_H
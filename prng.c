@@ -0,0 +1,51 @@
+/**
+ * @file prng.c
+ * @brief PCG32 generator and unbiased bounded draws.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "prng.h"
+
+#define PCG_MULTIPLIER 6364136223846793005ull
+
+void prngSeed(Prng *rng, uint64_t seed)
+{
+  // Inicialização de referência do PCG: a semente escolhe a sequência e o ponto de partida
+  rng->state = 0;
+  rng->inc = (seed << 1) | 1u;
+  prngNext(rng);
+  rng->state += seed ^ 0x853C49E6748FEA9Bull;
+  prngNext(rng);
+}
+
+uint32_t prngNext(Prng *rng)
+{
+  uint64_t old = rng->state;
+  rng->state = old * PCG_MULTIPLIER + rng->inc;
+
+  uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+  uint32_t rot = (uint32_t)(old >> 59);
+  return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
+uint32_t prngBelow(Prng *rng, uint32_t bound)
+{
+  // Multiplicação e deslocamento (Lemire): só divide no caso raro de rejeição
+  uint64_t m = (uint64_t)prngNext(rng) * bound;
+  uint32_t low = (uint32_t)m;
+
+  if (low < bound)
+  {
+    uint32_t threshold = -bound % bound;
+    while (low < threshold)
+    {
+      m = (uint64_t)prngNext(rng) * bound;
+      low = (uint32_t)m;
+    }
+  }
+
+  return (uint32_t)(m >> 32);
+}
@@ -0,0 +1,40 @@
+/**
+ * @file prng.h
+ * @brief Small PCG32 pseudo-random generator.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * PCG32 (XSH-RR variant): 64 bits of state, 32-bit outputs with good
+ * statistical quality, a handful of instructions per number. Used instead of
+ * newlib's rand(), whose low bits are weak and which pulls in reentrancy state.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef PRNG_H
+#define PRNG_H
+
+#include <stdint.h>
+
+typedef struct
+{
+  uint64_t state;
+  uint64_t inc; // Sempre ímpar: seleciona a sequência
+} Prng;
+
+/**
+ * @brief Seeds the generator. Any seed is fine, including 0.
+ */
+void prngSeed(Prng *rng, uint64_t seed);
+
+/**
+ * @brief Next 32-bit number.
+ */
+uint32_t prngNext(Prng *rng);
+
+/**
+ * @brief Uniform number in [0, bound) without modulo bias.
+ */
+uint32_t prngBelow(Prng *rng, uint32_t bound);
+
+#endif // PRNG_H
@@ -0,0 +1,114 @@
+/**
+ * @file question_pool.c
+ * @brief Question generation (PCG32) into a ring of ready-to-show slots.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "question_pool.h"
+
+#include "numtext.h"
+#include "prng.h"
+
+static Prng rng;
+static Question pool[QUESTION_POOL_SIZE];
+static uint32_t poolHead = 0; // Próximo slot a gerar
+static uint32_t poolTail = 0; // Próximo slot a entregar
+static QuestionKind currentKind = QUESTION_ADDITION;
+
+static void pickAddition(Question *q)
+{
+  q->a = (uint16_t)prngBelow(&rng, QUESTION_MAX_OPERAND + 1);
+  q->b = (uint16_t)prngBelow(&rng, QUESTION_MAX_OPERAND + 1);
+  q->answer = q->a + q->b;
+}
+
+static void pickSubtraction(Question *q)
+{
+  uint16_t x = (uint16_t)prngBelow(&rng, QUESTION_MAX_OPERAND + 1);
+  uint16_t y = (uint16_t)prngBelow(&rng, QUESTION_MAX_OPERAND + 1);
+  q->a = x > y ? x : y; // O maior primeiro
+  q->b = x > y ? y : x;
+  q->answer = q->a - q->b;
+}
+
+static void pickMultiplication(Question *q)
+{
+  q->a = (uint16_t)prngBelow(&rng, QUESTION_MAX_FACTOR + 1);
+  q->b = (uint16_t)prngBelow(&rng, QUESTION_MAX_FACTOR + 1);
+  q->answer = q->a * q->b;
+}
+
+// Um gerador por tipo de pergunta: sorteia os operandos e calcula a resposta
+static const struct
+{
+  char op;
+  void (*pick)(Question *q);
+} generators[QUESTION_KIND_COUNT] = {
+    [QUESTION_ADDITION] = {'+', pickAddition},
+    [QUESTION_SUBTRACTION] = {'-', pickSubtraction},
+    [QUESTION_MULTIPLICATION] = {'x', pickMultiplication},
+};
+
+static void generate(Question *q)
+{
+  generators[currentKind].pick(q);
+  q->op = generators[currentKind].op;
+
+  // "a + b = ?"
+  char *p = q->text;
+  p += formatNumber(p, q->a);
+  *p++ = ' ';
+  *p++ = q->op;
+  *p++ = ' ';
+  p += formatNumber(p, q->b);
+  *p++ = ' ';
+  *p++ = '=';
+  *p++ = ' ';
+  *p++ = '?';
+  *p = '\0';
+  q->length = (uint8_t)(p - q->text);
+}
+
+void questionPoolInit(uint64_t seed)
+{
+  prngSeed(&rng, seed);
+  currentKind = QUESTION_ADDITION;
+  poolHead = poolTail = 0;
+
+  while (questionPoolTopUp())
+    ;
+}
+
+void questionPoolSetKind(QuestionKind kind)
+{
+  if (kind >= QUESTION_KIND_COUNT)
+    return;
+  currentKind = kind;
+
+  // Descarta as prontas; o slot entregue por último (poolTail - 1) não é tocado
+  poolHead = poolTail;
+  while (questionPoolTopUp())
+    ;
+}
+
+bool questionPoolTopUp(void)
+{
+  // O slot entregue por último ainda está em uso, então o anel guarda SIZE - 1
+  if (poolHead - poolTail >= QUESTION_POOL_SIZE - 1)
+    return false;
+
+  generate(&pool[poolHead % QUESTION_POOL_SIZE]);
+  poolHead++;
+  return true;
+}
+
+const Question *questionPoolNext(void)
+{
+  if (poolHead == poolTail)
+    questionPoolTopUp(); // Esvaziou (jogador rápido demais): gera na hora
+
+  return &pool[poolTail++ % QUESTION_POOL_SIZE];
+}
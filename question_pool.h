@@ -0,0 +1,71 @@
+/**
+ * @file question_pool.h
+ * @brief Ring of pre-generated, pre-formatted arithmetic questions.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Questions are generated and formatted ahead of time, one per call to
+ * questionPoolTopUp() while the player is thinking, so moving to the next
+ * question only hands out a pointer to a ready slot. The kind of question
+ * (addition, subtraction, ...) picks the generator from a table.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef QUESTION_POOL_H
+#define QUESTION_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Quantidade de slots do anel (potência de 2); um fica reservado para a pergunta atual. */
+#define QUESTION_POOL_SIZE 8
+
+/** Maior parcela sorteada (as contas vão de 0 + 0 até 999 + 999). */
+#define QUESTION_MAX_OPERAND 999
+
+/** Maior fator da multiplicação (tabuada até 10 x 10). */
+#define QUESTION_MAX_FACTOR 10
+
+typedef enum
+{
+  QUESTION_ADDITION,
+  QUESTION_SUBTRACTION,    // Resultado nunca negativo
+  QUESTION_MULTIPLICATION, // Tabuada
+  QUESTION_KIND_COUNT
+} QuestionKind;
+
+typedef struct
+{
+  uint16_t a;
+  uint16_t b;
+  uint16_t answer;
+  char op;        // '+', '-' ou 'x'
+  uint8_t length; // Caracteres de text
+  char text[16];  // "999 + 999 = ?"
+} Question;
+
+/**
+ * @brief Seeds the generator and fills the whole pool with additions.
+ */
+void questionPoolInit(uint64_t seed);
+
+/**
+ * @brief Switches the kind of question and refills the pool with it.
+ * The question handed out last stays valid.
+ */
+void questionPoolSetKind(QuestionKind kind);
+
+/**
+ * @brief Generates one question if there is a free slot.
+ * @return true if a question was added
+ */
+bool questionPoolTopUp(void);
+
+/**
+ * @brief Takes the next question. Stays valid until the following call.
+ * If the pool ran dry, a question is generated on the spot.
+ */
+const Question *questionPoolNext(void);
+
+#endif // QUESTION_POOL_H
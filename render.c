@@ -0,0 +1,537 @@
+/**
+ * @file render.c
+ * @brief Screen drawing and LED effects for each game state.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "render.h"
+
+#include "pico/stdlib.h"
+#include "led_effects.h"
+#include "oled.h"
+#include "oled_draw.h"
+#include "oled_text_cache.h"
+#include "hud.h"
+#include "numtext.h"
+#include "frame_scheduler.h"
+#include "tween.h"
+#include "latency_trace.h"
+
+#if PATROSUM_DUAL_CORE
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#endif
+
+#define ERROR_BLINK_MS 150 // Meio período da piscada do LED vermelho
+#define ERROR_BLINK_COUNT 3
+#define WAITING_PULSE_LEVEL 51      // Brilho máximo da respiração (20%)
+#define WAITING_PULSE_PERIOD_MS 2000
+#define ATTRACT_FADE_MS 1000 // Apagamento dos LEDs ao entrar na tela de espera
+#define ATTRACT_MOVE_MS 4000 // O texto da tela de espera muda de lugar (evita marcar o OLED)
+#define HUD_BAR_HEIGHT 4     // Barras no topo e no pé da tela de pergunta
+
+// Estado que só o pipeline de desenho conhece
+static GameState lastState = GENERATE_NEW_QUESTION;
+static uint32_t lastQuestionId = 0;
+static PowerMode lastPowerMode = POWER_ACTIVE;
+static bool panelInverted = false;
+
+// Animações, avançadas pelo delta do agendador de quadros
+static Tween questionY = {
+    .from = TWEEN_FROM_INT(QUESTION_Y_IDLE),
+    .to = TWEEN_FROM_INT(QUESTION_Y_IDLE),
+    .value = TWEEN_FROM_INT(QUESTION_Y_IDLE),
+};
+static Tween questionSlide; // Deslocamento horizontal da conta ao trocar de pergunta
+static Tween resultFlash;   // Conta as meias piscadas do painel invertido
+
+// Envio em andamento: o que o fim dele confirma (lido na interrupção do DMA)
+static uint32_t flushedQuestionId = 0;              // Última pergunta entregue a um envio
+static volatile uint32_t committingQuestionId = 0; // Pergunta nova neste envio, 0 se nenhuma
+
+#if PATROSUM_LATENCY_TRACE
+static uint8_t tracedDigits = 0;
+static bool tracedChangePending = false; // Resposta mudou e o quadro ainda não foi aceito
+static volatile bool committingLatency = false;
+#endif
+
+static void setPanelInverted(bool inverted)
+{
+  if (inverted == panelInverted)
+    return; // Um comando I2C só quando muda
+  panelInverted = inverted;
+  oledSetInverted(inverted);
+}
+
+// Widgets das telas, montados uma vez e redesenhados só quando o valor ligado muda
+static HudWidget topBar, bottomBar, titleLabel, turnField, questionText, answerText, hintLabel;
+static HudWidget sendKeyLabel, sendLabel, clearKeyLabel, clearLabel;
+static HudWidget *const questionWidgets[] = {
+    &topBar, &bottomBar, &hintLabel, &titleLabel, &turnField, &questionText, &answerText,
+    &sendKeyLabel, &sendLabel, &clearKeyLabel, &clearLabel};
+
+// Com vários jogadores, o placar de cada um ocupa o lugar de "Seguidos" e "Recorde"
+static HudWidget correctLabel, wrongLabel, correctAnswerField, streakField, bestField, playerRows[MAX_PLAYERS];
+static HudWidget *const resultWidgets[] = {
+    &correctLabel, &wrongLabel, &correctAnswerField, &streakField, &bestField,
+    &playerRows[0], &playerRows[1], &playerRows[2], &playerRows[3]};
+
+static HudWidget leaderboardTitle, leaderboardRows[SPEED_LEADERBOARD_SIZE], roundField;
+static HudWidget *const leaderboardWidgets[] = {
+    &leaderboardTitle, &leaderboardRows[0], &leaderboardRows[1], &leaderboardRows[2], &roundField};
+
+static bool screensReady = false;
+static uint8_t pendingPages = 0; // Páginas desenhadas que o painel ainda não recebeu
+
+/**
+ * @brief Lays out the widgets of every screen (once).
+ */
+static void initScreens(void)
+{
+  if (screensReady)
+    return;
+  screensReady = true;
+
+  hudInitBar(&topBar, 0, 0, OLED_WIDTH, HUD_BAR_HEIGHT);
+  hudInitBar(&bottomBar, 0, OLED_HEIGHT - HUD_BAR_HEIGHT, OLED_WIDTH, OLED_HEIGHT);
+  hudInitLabel(&titleLabel, HUD_ALIGN_CENTER, OLED_WIDTH / 2, QUESTION_Y_IDLE, "Resolva a conta:");
+  hudInitText(&turnField, HUD_ALIGN_CENTER, OLED_WIDTH / 2, QUESTION_Y_IDLE);
+  hudInitText(&questionText, HUD_ALIGN_CENTER, OLED_WIDTH / 2, QUESTION_Y_IDLE + 16);
+  hudInitText(&answerText, HUD_ALIGN_CENTER, OLED_WIDTH / 2, 40);
+  hudInitLabel(&hintLabel, HUD_ALIGN_CENTER, OLED_WIDTH / 2, 7, "Digite a resposta");
+  hudInitLabel(&sendKeyLabel, HUD_ALIGN_LEFT, 0, OLED_HEIGHT - 20, "A");
+  hudInitLabel(&sendLabel, HUD_ALIGN_LEFT, 0, OLED_HEIGHT - 13, "enviar");
+  // Alinhadas à direita: a posição sai do layout, calculado só uma vez
+  hudInitLabel(&clearKeyLabel, HUD_ALIGN_RIGHT, OLED_WIDTH - 2, OLED_HEIGHT - 20, "*");
+  hudInitLabel(&clearLabel, HUD_ALIGN_RIGHT, OLED_WIDTH - 2, OLED_HEIGHT - 13, "limpar");
+
+  hudInitLabel(&correctLabel, HUD_ALIGN_CENTER, OLED_WIDTH / 2, 8, "Correto! :)");
+  hudInitLabel(&wrongLabel, HUD_ALIGN_CENTER, OLED_WIDTH / 2, 0, "Errado! :(");
+  hudInitNumber(&correctAnswerField, HUD_ALIGN_CENTER, OLED_WIDTH / 2, 16, "Resp: ");
+  hudInitNumber(&streakField, HUD_ALIGN_CENTER, OLED_WIDTH / 2, 36, "Seguidos: ");
+  hudInitNumber(&bestField, HUD_ALIGN_CENTER, OLED_WIDTH / 2, 48, "Recorde: ");
+  // Da borda esquerda: ">J4: 65535 de 65535" ocupa 114 dos 128 pixels
+  for (int i = 0; i < MAX_PLAYERS; i++)
+    hudInitText(&playerRows[i], HUD_ALIGN_LEFT, 0, 28 + 9 * i);
+
+  hudInitLabel(&leaderboardTitle, HUD_ALIGN_CENTER, OLED_WIDTH / 2, 0, "Placar");
+  for (int i = 0; i < SPEED_LEADERBOARD_SIZE; i++)
+    hudInitText(&leaderboardRows[i], HUD_ALIGN_LEFT, 4, 14 + 12 * i);
+  hudInitText(&roundField, HUD_ALIGN_CENTER, OLED_WIDTH / 2, 54);
+}
+
+/**
+ * @brief Starts a screen from a blank framebuffer: all its widgets are drawn again.
+ */
+static void beginScreen(HudWidget *const *widgets, size_t count)
+{
+  initScreens();
+  oledClear();
+  hudInvalidate(widgets, count);
+  pendingPages = OLED_ALL_PAGES;
+}
+
+/**
+ * @brief Sends the pages drawn since the last accepted flush.
+ * @return true if the flush was accepted
+ */
+static bool flushPendingPages(OledFlushCallback onComplete)
+{
+  if (!oledShowPagesAsync(pendingPages, onComplete))
+    return false; // DMA ocupado: as páginas continuam pendentes
+  pendingPages = 0;
+  return true;
+}
+
+void renderInvalidateScreen(void)
+{
+  initScreens();
+  oledClear();
+  hudInvalidate(questionWidgets, count_of(questionWidgets));
+  hudInvalidate(resultWidgets, count_of(resultWidgets));
+  hudInvalidate(leaderboardWidgets, count_of(leaderboardWidgets));
+  pendingPages = OLED_ALL_PAGES;
+}
+
+/**
+ * @brief Appends text to a row being built; returns the new end.
+ */
+static char *appendText(char *out, const char *text)
+{
+  while (*text)
+    *out++ = *text++;
+  return out;
+}
+
+/**
+ * @brief ">J2: 3 de 5" (the marker flags the player whose turn it is).
+ * @return Characters written
+ */
+static uint8_t formatPlayerRow(char *row, int player, const PlayerScore *score, bool active)
+{
+  char *out = row;
+  *out++ = active ? '>' : ' ';
+  *out++ = 'J';
+  out += formatNumber(out, (uint16_t)(player + 1));
+  out = appendText(out, ": ");
+  out += formatNumber(out, score->correct);
+  out = appendText(out, " de ");
+  out += formatNumber(out, score->answered);
+  *out = '\0';
+  return (uint8_t)(out - row);
+}
+
+void renderDrawQuestionScreen(const GameSnapshot *s, uint32_t dtUs)
+{
+  initScreens();
+
+  uint8_t len = s->answer.digits;
+  // Ajusta a posição Y da pergunta se houver resposta
+  tweenTo(&questionY, TWEEN_FROM_INT(len > 0 ? QUESTION_Y_ANSWERING : QUESTION_Y_IDLE), QUESTION_SLIDE_MS, EASE_OUT_QUAD);
+  tweenUpdate(&questionY, dtUs);
+  tweenUpdate(&questionSlide, dtUs);
+  int y = tweenInt(&questionY);
+
+  // Na rodada cronometrada a barra do topo encolhe com o tempo que resta
+  int barWidth = OLED_WIDTH;
+  if (s->speedRound)
+  {
+    int64_t leftUs = absolute_time_diff_us(get_absolute_time(), s->roundEndsAt);
+    barWidth = leftUs > 0 ? (int)(leftUs * OLED_WIDTH / ((int64_t)SPEED_ROUND_MS * 1000)) : 0;
+  }
+  hudSetBarWidth(&topBar, barWidth);
+
+  // Cada widget só fica sujo se o valor ou a posição mudou desde o último quadro
+  hudSetPosition(&titleLabel, OLED_WIDTH / 2, y);
+
+  // Vários jogadores: o título diz de quem é a vez
+  bool hotSeat = s->playerCount > 1;
+  hudSetVisible(&titleLabel, !hotSeat);
+  hudSetVisible(&turnField, hotSeat);
+  if (hotSeat)
+  {
+    char turn[HUD_TEXT_MAX + 1];
+    char *out = appendText(turn, "Vez do jogador ");
+    out += formatNumber(out, (uint16_t)(s->activePlayer + 1));
+    hudSetText(&turnField, turn, (uint8_t)(out - turn));
+    hudSetPosition(&turnField, OLED_WIDTH / 2, y);
+  }
+  hudSetText(&questionText, s->questionStr, s->questionLen);
+  hudSetPosition(&questionText, OLED_WIDTH / 2 + tweenInt(&questionSlide), y + 16);
+  hudSetText(&answerText, s->answer.text, len);
+  hudSetVisible(&hintLabel, !time_reached(s->answerHintUntil));
+
+  // Instruções para enviar e limpar, só com resposta digitada
+  hudSetVisible(&sendKeyLabel, len > 0);
+  hudSetVisible(&sendLabel, len > 0);
+  hudSetVisible(&clearKeyLabel, len > 0);
+  hudSetVisible(&clearLabel, len > 0);
+
+  pendingPages |= hudRender(questionWidgets, count_of(questionWidgets));
+}
+
+static void enterQuestionScreen(const GameSnapshot *s)
+{
+  (void)s;
+  beginScreen(questionWidgets, count_of(questionWidgets));
+
+  // Respiração branca enquanto espera a resposta
+  ledPulse(LED_RED_PIN, WAITING_PULSE_LEVEL, WAITING_PULSE_PERIOD_MS);
+  ledPulse(LED_GREEN_PIN, WAITING_PULSE_LEVEL, WAITING_PULSE_PERIOD_MS);
+  ledPulse(LED_BLUE_PIN, WAITING_PULSE_LEVEL, WAITING_PULSE_PERIOD_MS);
+}
+
+void renderDrawResultScreen(const GameSnapshot *s)
+{
+  initScreens();
+
+  hudSetVisible(&correctLabel, s->lastAnswerCorrect);
+  hudSetVisible(&wrongLabel, !s->lastAnswerCorrect);
+  hudSetVisible(&correctAnswerField, !s->lastAnswerCorrect);
+  hudSetNumber(&correctAnswerField, (uint16_t)s->correctAnswer);
+  hudSetNumber(&streakField, s->streak);
+  hudSetNumber(&bestField, s->bestStreak);
+
+  bool hotSeat = s->playerCount > 1;
+  hudSetVisible(&streakField, !hotSeat);
+  hudSetVisible(&bestField, !hotSeat);
+  char row[HUD_TEXT_MAX + FORMAT_NUMBER_SIZE * 3];
+  for (int i = 0; i < MAX_PLAYERS; i++)
+  {
+    hudSetVisible(&playerRows[i], i < s->playerCount && hotSeat);
+    if (i < s->playerCount && hotSeat)
+      hudSetText(&playerRows[i], row, formatPlayerRow(row, i, &s->players[i], i == s->activePlayer));
+  }
+
+  pendingPages |= hudRender(resultWidgets, count_of(resultWidgets));
+}
+
+static void enterResultScreen(const GameSnapshot *s)
+{
+  if (s->lastAnswerCorrect)
+  {
+    ledSolid(LED_RED_PIN, 0);     // Desliga o LED vermelho
+    ledSolid(LED_GREEN_PIN, 255); // Liga o LED verde
+    ledSolid(LED_BLUE_PIN, 0);    // Desliga o LED azul
+    tweenSet(&resultFlash, 0);    // Sem piscada (interrompe a de um erro pulado)
+  }
+  else
+  {
+    ledBlink(LED_RED_PIN, 255, ERROR_BLINK_MS, ERROR_BLINK_COUNT, 255); // Pisca e fica aceso
+    ledSolid(LED_GREEN_PIN, 0);                                          // Desliga o LED verde
+    ledSolid(LED_BLUE_PIN, 0);                                           // Desliga o LED azul
+
+    // O painel pisca invertido junto com o LED vermelho
+    tweenStart(&resultFlash, 0, TWEEN_FROM_INT(2 * ERROR_BLINK_COUNT), 2 * ERROR_BLINK_COUNT * ERROR_BLINK_MS,
+               EASE_LINEAR);
+  }
+
+  beginScreen(resultWidgets, count_of(resultWidgets));
+  renderDrawResultScreen(s); // A tela de resultado é desenhada uma vez só
+}
+
+/**
+ * @brief ">1. 12 certas 1234ms" (the marker flags the round just played).
+ * @return Characters written (numtext only, no printf)
+ */
+static uint8_t formatScoreRow(char *row, int position, const SpeedScore *score, bool justPlayed)
+{
+  char *out = row;
+  *out++ = justPlayed ? '>' : ' ';
+  out += formatNumber(out, (uint16_t)(position + 1));
+  out = appendText(out, ". ");
+  out += formatNumber(out, score->correct);
+  out = appendText(out, " certas ");
+  out += formatNumber(out, speedScoreMeanMs(score));
+  out = appendText(out, "ms");
+  *out = '\0';
+  return (uint8_t)(out - row);
+}
+
+void renderDrawLeaderboardScreen(const GameSnapshot *s)
+{
+  initScreens();
+
+  char row[HUD_TEXT_MAX + FORMAT_NUMBER_SIZE * 3];
+  for (int i = 0; i < SPEED_LEADERBOARD_SIZE; i++)
+  {
+    hudSetVisible(&leaderboardRows[i], i < s->leaderboard.count);
+    if (i < s->leaderboard.count)
+      hudSetText(&leaderboardRows[i], row, formatScoreRow(row, i, &s->leaderboard.entries[i], i == s->leaderboardRank));
+  }
+
+  // Rodada que acabou: acertos de respostas, mesmo fora do placar
+  char *out = appendText(row, "Rodada: ");
+  out += formatNumber(out, s->roundScore.correct);
+  out = appendText(out, " de ");
+  out += formatNumber(out, s->roundScore.answered);
+  hudSetText(&roundField, row, (uint8_t)(out - row));
+
+  pendingPages |= hudRender(leaderboardWidgets, count_of(leaderboardWidgets));
+}
+
+static void enterLeaderboardScreen(const GameSnapshot *s)
+{
+  // Azul enquanto mostra o placar
+  ledSolid(LED_RED_PIN, 0);
+  ledSolid(LED_GREEN_PIN, 0);
+  ledSolid(LED_BLUE_PIN, 255);
+  tweenSet(&resultFlash, 0);
+
+  beginScreen(leaderboardWidgets, count_of(leaderboardWidgets));
+  renderDrawLeaderboardScreen(s); // Também desenhada uma vez só
+}
+
+void renderDrawAttractScreen(void)
+{
+  static const uint8_t attractRows[] = {8, 20, 32, 20};
+  uint32_t step = to_ms_since_boot(get_absolute_time()) / ATTRACT_MOVE_MS;
+  int y = attractRows[step % count_of(attractRows)];
+
+  oledClear();
+  oledDrawTextCenteredCached("PatroSum", y);
+  oledDrawTextCenteredCached("Pressione uma tecla", y + 16);
+}
+
+static void enterPowerMode(PowerMode mode)
+{
+  switch (mode)
+  {
+  case POWER_ATTRACT:
+    ledFade(LED_RED_PIN, 0, ATTRACT_FADE_MS, EASE_IN_OUT_QUAD);
+    ledFade(LED_GREEN_PIN, 0, ATTRACT_FADE_MS, EASE_IN_OUT_QUAD);
+    ledFade(LED_BLUE_PIN, 0, ATTRACT_FADE_MS, EASE_IN_OUT_QUAD);
+    oledSetContrast(OLED_DIM_CONTRAST);
+    break;
+  case POWER_SLEEP:
+    ledSolid(LED_RED_PIN, 0);
+    ledSolid(LED_GREEN_PIN, 0);
+    ledSolid(LED_BLUE_PIN, 0);
+    oledSetPower(false);
+    break;
+  case POWER_ACTIVE:
+    oledSetPower(true);
+    oledSetContrast(OLED_DEFAULT_CONTRAST);
+    lastState = GENERATE_NEW_QUESTION; // Refaz a entrada na tela atual (LEDs e resultado)
+    break;
+  }
+}
+
+/**
+ * @brief End of a question frame flush, called from the DMA interrupt.
+ */
+static void __not_in_flash_func(questionFrameCommitted)(void)
+{
+  // A primeira vez que a pergunta chega ao painel inicia o tempo de resposta
+  if (committingQuestionId)
+    publishQuestionShown(committingQuestionId, time_us_32());
+#if PATROSUM_LATENCY_TRACE
+  if (committingLatency)
+    latencyDisplayCommitted();
+#endif
+}
+
+static void drawQuestionFrame(const GameSnapshot *s, uint32_t dtUs)
+{
+  renderDrawQuestionScreen(s, dtUs);
+#if PATROSUM_LATENCY_TRACE
+  // O fim do envio que mostra a resposta nova fecha a medição da tecla
+  if (s->answer.digits != tracedDigits)
+  {
+    tracedDigits = s->answer.digits;
+    tracedChangePending = true;
+  }
+#endif
+
+  if (oledBusy())
+    return; // As páginas ficam pendentes; o envio anterior ainda pode ler o que ele confirma
+
+  committingQuestionId = s->questionId != flushedQuestionId ? s->questionId : 0;
+  flushedQuestionId = s->questionId;
+#if PATROSUM_LATENCY_TRACE
+  committingLatency = tracedChangePending;
+  tracedChangePending = false;
+#endif
+  flushPendingPages(questionFrameCommitted); // Envia em segundo plano enquanto o loop segue
+}
+
+static void drawResultFrame(const GameSnapshot *s, uint32_t dtUs)
+{
+  (void)s;
+
+  // Meias piscadas pares invertem o painel; ímpares e o fim voltam ao normal
+  tweenUpdate(&resultFlash, dtUs);
+  setPanelInverted(!tweenDone(&resultFlash) && (resultFlash.value / TWEEN_ONE) % 2 == 0);
+
+  // O quadro não muda: só reenvia se a última tentativa encontrou o DMA ocupado
+  flushPendingPages(NULL);
+}
+
+/**
+ * @brief Screen of one game state: set up once on entry, then drawn every frame.
+ */
+typedef struct
+{
+  void (*enter)(const GameSnapshot *s);
+  void (*draw)(const GameSnapshot *s, uint32_t dtUs);
+} ScreenHandlers;
+
+static const ScreenHandlers screens[GAME_STATE_COUNT] = {
+    [WAITING_FOR_INPUT] = {enterQuestionScreen, drawQuestionFrame},
+    [SHOWING_RESULT] = {enterResultScreen, drawResultFrame},
+    [SHOWING_LEADERBOARD] = {enterLeaderboardScreen, drawResultFrame},
+};
+
+void renderFrame(const GameSnapshot *snapshot, uint32_t dtUs)
+{
+  if (snapshot->powerMode != lastPowerMode)
+  {
+    lastPowerMode = snapshot->powerMode;
+    enterPowerMode(snapshot->powerMode);
+  }
+
+  // A inversão só vale durante a piscada da tela de resultado
+  if (snapshot->powerMode != POWER_ACTIVE || snapshot->state != SHOWING_RESULT)
+    setPanelInverted(false);
+
+  if (snapshot->powerMode == POWER_ATTRACT)
+  {
+    renderDrawAttractScreen();
+    oledShowAsync(NULL); // Só mudanças de posição geram tráfego
+    return;
+  }
+  if (snapshot->powerMode == POWER_SLEEP)
+    return; // Painel desligado
+
+  if (snapshot->questionId != lastQuestionId)
+  {
+    lastQuestionId = snapshot->questionId;
+    tweenSet(&questionY, TWEEN_FROM_INT(QUESTION_Y_IDLE)); // Reseta a posição Y da pergunta
+    if (snapshot->speedRound)
+      tweenSet(&questionSlide, 0); // Cronometrada: a conta aparece inteira no primeiro quadro
+    else
+      tweenStart(&questionSlide, TWEEN_FROM_INT(OLED_WIDTH), 0, QUESTION_ENTER_MS, EASE_OUT_BACK);
+  }
+
+  const ScreenHandlers *screen = &screens[snapshot->state];
+  if (snapshot->state != lastState && screen->enter)
+    screen->enter(snapshot);
+  lastState = snapshot->state;
+
+  if (screen->draw)
+    screen->draw(snapshot, dtUs); // Estados transitórios não têm tela própria
+}
+
+#if PATROSUM_DUAL_CORE
+static volatile bool renderParked = false;
+
+/**
+ * @brief Core 1 entry point: renders the latest snapshot at a fixed rate.
+ */
+static void renderCoreMain(void)
+{
+  multicore_lockout_victim_init(); // O core 0 pausa este core enquanto grava na flash
+
+  GameSnapshot snapshot;
+  FrameScheduler scheduler;
+  frameSchedulerInit(&scheduler, "render", PATROSUM_RENDER_HZ);
+
+  while (true)
+  {
+    uint32_t dtUs = frameBegin(&scheduler);
+
+    readGameSnapshot(&snapshot);
+    renderFrame(&snapshot, dtUs);
+
+    if (snapshot.powerMode == POWER_SLEEP)
+    {
+      // Painel e LEDs já apagados: espera sem gastar ciclos até o core 0 publicar outro modo
+      renderParked = true;
+      do
+      {
+        __wfe();
+        readGameSnapshot(&snapshot);
+      } while (snapshot.powerMode == POWER_SLEEP);
+      renderParked = false;
+
+      frameSchedulerResync(&scheduler);
+      continue;
+    }
+
+    frameEnd(&scheduler);
+  }
+}
+
+void startRenderCore(void)
+{
+  multicore_launch_core1(renderCoreMain);
+}
+
+bool renderIsParked(void)
+{
+  return renderParked;
+}
+#endif
@@ -0,0 +1,79 @@
+/**
+ * @file render.h
+ * @brief Render and LED effects pipeline, driven by game snapshots.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * With PATROSUM_DUAL_CORE the pipeline runs on core 1 and never shares a
+ * cycle with input handling. Otherwise core 0 calls renderFrame() from its
+ * own loop. Either way the display and the LEDs are only touched from here.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "game_snapshot.h"
+
+/** Quadros por segundo do pipeline de desenho (configurável no CMake). */
+#ifndef PATROSUM_RENDER_HZ
+#define PATROSUM_RENDER_HZ 100
+#endif
+
+// Animações da tela de pergunta
+#define QUESTION_Y_IDLE 20      // Posição da pergunta sem resposta digitada
+#define QUESTION_Y_ANSWERING 12 // Sobe para dar lugar à resposta
+#define QUESTION_SLIDE_MS 120   // Subida/descida quando a resposta aparece/some
+#define QUESTION_ENTER_MS 300   // Nova pergunta entra pela direita
+
+/**
+ * @brief Draws one frame and updates the LEDs for the given snapshot.
+ * @param dtUs Time since the previous frame, used to advance animations
+ */
+void renderFrame(const GameSnapshot *snapshot, uint32_t dtUs);
+
+/**
+ * @brief Updates the question screen widgets in the framebuffer (no flush, no LEDs).
+ * Only the widgets whose value or position changed are redrawn.
+ */
+void renderDrawQuestionScreen(const GameSnapshot *snapshot, uint32_t dtUs);
+
+/**
+ * @brief Updates the result screen widgets in the framebuffer (no flush, no LEDs).
+ */
+void renderDrawResultScreen(const GameSnapshot *snapshot);
+
+/**
+ * @brief Updates the speed round leaderboard widgets (no flush, no LEDs).
+ */
+void renderDrawLeaderboardScreen(const GameSnapshot *snapshot);
+
+/**
+ * @brief Clears the framebuffer and makes the next draw repaint every widget.
+ */
+void renderInvalidateScreen(void);
+
+/**
+ * @brief Draws the idle (attract) screen into the framebuffer.
+ * The text moves every few seconds so it doesn't burn into the panel.
+ */
+void renderDrawAttractScreen(void);
+
+#if PATROSUM_DUAL_CORE
+/**
+ * @brief Launches the render loop on core 1.
+ */
+void startRenderCore(void);
+
+/**
+ * @brief Returns true once core 1 has blanked the panel for POWER_SLEEP
+ * and is waiting for the next snapshot.
+ */
+bool renderIsParked(void);
+#endif
+
+#endif // RENDER_H
@@ -0,0 +1,67 @@
+/**
+ * @file speed_round.c
+ * @brief Speed round scores and the insertion into the leaderboard.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "speed_round.h"
+
+void speedScoreReset(SpeedScore *score)
+{
+  score->correct = 0;
+  score->answered = 0;
+  score->totalUs = 0;
+}
+
+void speedScoreRecord(SpeedScore *score, bool correct, uint32_t responseUs)
+{
+  score->answered++;
+  if (!correct)
+    return;
+  score->correct++;
+  score->totalUs += responseUs; // Uma rodada inteira cabe em 32 bits (71 minutos)
+}
+
+uint16_t speedScoreMeanMs(const SpeedScore *score)
+{
+  if (score->correct == 0)
+    return 0;
+  uint32_t meanMs = score->totalUs / score->correct / 1000;
+  return (uint16_t)(meanMs < UINT16_MAX ? meanMs : UINT16_MAX);
+}
+
+bool speedScoreBetter(const SpeedScore *a, const SpeedScore *b)
+{
+  if (a->correct != b->correct)
+    return a->correct > b->correct;
+  return a->totalUs < b->totalUs; // Empate em acertos: quem foi mais rápido
+}
+
+void speedLeaderboardClear(SpeedLeaderboard *board)
+{
+  board->count = 0;
+}
+
+int speedLeaderboardInsert(SpeedLeaderboard *board, const SpeedScore *score)
+{
+  if (score->correct == 0)
+    return -1;
+
+  // Posição: depois de todos que são melhores ou empatam (quem chegou antes fica na frente)
+  int rank = 0;
+  while (rank < board->count && !speedScoreBetter(score, &board->entries[rank]))
+    rank++;
+  if (rank >= SPEED_LEADERBOARD_SIZE)
+    return -1;
+
+  int last = board->count < SPEED_LEADERBOARD_SIZE ? board->count : SPEED_LEADERBOARD_SIZE - 1;
+  for (int i = last; i > rank; i--)
+    board->entries[i] = board->entries[i - 1];
+  board->entries[rank] = *score;
+  if (board->count < SPEED_LEADERBOARD_SIZE)
+    board->count++;
+  return rank;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file speed_round.h
+ * @brief Scoring of timed speed rounds and the session leaderboard.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * A round lasts SPEED_ROUND_MS. Each answer is timed from the moment the
+ * first frame showing the question reached the panel to the scan that first
+ * saw the 'A' key closed, so the error is bounded by one keypad scan period.
+ * More correct answers rank higher; ties go to the lower total time.
+ *
+ * The leaderboard lives in RAM and lasts for the session.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef SPEED_ROUND_H
+#define SPEED_ROUND_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Duração de uma rodada cronometrada. */
+#ifndef SPEED_ROUND_MS
+#define SPEED_ROUND_MS 60000
+#endif
+
+/** Tempo mostrando o resultado de cada conta durante a rodada. */
+#ifndef SPEED_RESULT_MS
+#define SPEED_RESULT_MS 400
+#endif
+
+/** Tempo máximo exibindo o placar no fim da rodada. */
+#ifndef SPEED_LEADERBOARD_MS
+#define SPEED_LEADERBOARD_MS 8000
+#endif
+
+/** Posições do placar (cabem na tela junto com o título e a rodada). */
+#define SPEED_LEADERBOARD_SIZE 3
+
+typedef struct
+{
+  uint16_t correct;  // Acertos na rodada
+  uint16_t answered; // Respostas enviadas
+  uint32_t totalUs;  // Soma dos tempos de resposta dos acertos
+} SpeedScore;
+
+typedef struct
+{
+  SpeedScore entries[SPEED_LEADERBOARD_SIZE]; // Do melhor para o pior
+  uint8_t count;
+} SpeedLeaderboard;
+
+/**
+ * @brief Starts an empty score.
+ */
+void speedScoreReset(SpeedScore *score);
+
+/**
+ * @brief Adds one answer; only correct answers add their time.
+ */
+void speedScoreRecord(SpeedScore *score, bool correct, uint32_t responseUs);
+
+/**
+ * @brief Mean response time of the correct answers, in milliseconds.
+ */
+uint16_t speedScoreMeanMs(const SpeedScore *score);
+
+/**
+ * @brief Returns true if a ranks strictly above b.
+ */
+bool speedScoreBetter(const SpeedScore *a, const SpeedScore *b);
+
+/**
+ * @brief Empties the leaderboard.
+ */
+void speedLeaderboardClear(SpeedLeaderboard *board);
+
+/**
+ * @brief Inserts a finished round, pushing the last entry out if needed.
+ * Rounds without a correct answer are not ranked.
+ * @return Position taken (0 = first), or -1 if the round did not rank
+ */
+int speedLeaderboardInsert(SpeedLeaderboard *board, const SpeedScore *score);
+
+#endif // SPEED_ROUND_H
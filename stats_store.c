@@ -0,0 +1,244 @@
+/**
+ * @file stats_store.c
+ * @brief Append-only statistics log in the last flash sectors.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Records are written in order inside a sector, and sectors in order around
+ * the region, each record carrying a sequence number one above the previous
+ * one. A record whose write was cut by a reset fails its check and the scan
+ * falls back to the one before it.
+ *
+ * A record is programmed by writing its whole flash page with 0xFF
+ * everywhere else: programming a 0xFF byte leaves the cell unchanged, so
+ * the records already in the page stay intact.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "stats_store.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+
+#if PATROSUM_DUAL_CORE
+#include "pico/multicore.h"
+#endif
+
+#define STATS_RECORD_MAGIC 0x54535350u // "PSST" na flash
+#define STATS_ERASED_WORD 0xFFFFFFFFu
+
+typedef struct
+{
+  uint32_t magic;       // STATS_RECORD_MAGIC; apagado (0xFFFFFFFF) = slot livre
+  uint32_t sequence;    // Um acima do registro anterior
+  GameStats stats;      // 12 bytes
+  uint32_t reserved[2]; // 0xFFFFFFFF (espaço para campos novos)
+  uint32_t check;       // FNV-1a dos bytes anteriores
+} StatsRecord;
+
+#define STATS_SLOTS_PER_SECTOR (FLASH_SECTOR_SIZE / sizeof(StatsRecord))
+#define STATS_LOG_SLOTS (STATS_LOG_SECTORS * STATS_SLOTS_PER_SECTOR)
+#define STATS_LOG_OFFSET (PICO_FLASH_SIZE_BYTES - STATS_LOG_SECTORS * FLASH_SECTOR_SIZE)
+
+// Índice na RAM: só a posição de escrita e o próximo número de sequência
+static uint32_t nextSlot = 0;
+static uint32_t nextSequence = 0;
+static bool upcomingReady = false; // O próximo setor a receber registros já está apagado
+
+static GameStats pendingStats;
+static bool pending = false;
+static absolute_time_t nextSaveAt;
+
+static uint8_t pageBuffer[FLASH_PAGE_SIZE]; // Página montada para flash_range_program
+
+static const StatsRecord *slotAt(uint32_t slot)
+{
+  return (const StatsRecord *)(XIP_BASE + STATS_LOG_OFFSET) + slot;
+}
+
+static uint32_t recordCheck(const StatsRecord *r)
+{
+  const uint8_t *bytes = (const uint8_t *)r;
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < offsetof(StatsRecord, check); i++)
+    hash = (hash ^ bytes[i]) * 16777619u;
+  return hash;
+}
+
+static bool recordValid(const StatsRecord *r)
+{
+  return r->magic == STATS_RECORD_MAGIC && r->check == recordCheck(r);
+}
+
+static bool slotErased(const StatsRecord *r)
+{
+  const uint32_t *words = (const uint32_t *)r;
+  for (size_t i = 0; i < sizeof(StatsRecord) / sizeof(uint32_t); i++)
+    if (words[i] != STATS_ERASED_WORD)
+      return false;
+  return true;
+}
+
+/**
+ * @brief Sector the log writes into next at a sector boundary: the one that
+ * starts at nextSlot, or else the one after the current write sector.
+ */
+static uint32_t upcomingSector(void)
+{
+  uint32_t sector = nextSlot / STATS_SLOTS_PER_SECTOR;
+  if (nextSlot % STATS_SLOTS_PER_SECTOR == 0)
+    return sector;
+  return (sector + 1) % STATS_LOG_SECTORS;
+}
+
+static bool sectorErased(uint32_t sector)
+{
+  for (uint32_t i = 0; i < STATS_SLOTS_PER_SECTOR; i++)
+    if (!slotErased(slotAt(sector * STATS_SLOTS_PER_SECTOR + i)))
+      return false;
+  return true;
+}
+
+void statsStoreLoad(GameStats *out)
+{
+  memset(out, 0, sizeof(*out));
+  nextSlot = 0;
+  nextSequence = 0;
+  upcomingReady = false;
+  pending = false;
+  nextSaveAt = nil_time; // O primeiro resultado depois do boot é gravado logo
+
+  // O primeiro registro de cada setor diz qual setor é o mais novo
+  int newest = -1;
+  uint32_t newestSequence = 0;
+  for (int s = 0; s < STATS_LOG_SECTORS; s++)
+  {
+    const StatsRecord *r = slotAt(s * STATS_SLOTS_PER_SECTOR);
+    if (recordValid(r) && (newest < 0 || (int32_t)(r->sequence - newestSequence) > 0))
+    {
+      newest = s;
+      newestSequence = r->sequence;
+    }
+  }
+  if (newest < 0)
+    return; // Log vazio (ou nunca usado): o setor 0 é o próximo a apagar
+
+  // Dentro do setor os slots são gravados em ordem: busca binária do primeiro livre
+  uint32_t base = (uint32_t)newest * STATS_SLOTS_PER_SECTOR;
+  uint32_t lo = 1;
+  uint32_t hi = STATS_SLOTS_PER_SECTOR;
+  while (lo < hi)
+  {
+    uint32_t mid = (lo + hi) / 2;
+    if (slotAt(base + mid)->magic == STATS_ERASED_WORD)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+
+  // Uma gravação cortada por um reset falha na verificação: vale a anterior
+  uint32_t last = lo - 1;
+  while (last > 0 && !recordValid(slotAt(base + last)))
+    last--;
+  *out = slotAt(base + last)->stats;
+  nextSequence = slotAt(base + last)->sequence + 1;
+
+  // Pula um slot livre com restos de uma gravação interrompida
+  uint32_t firstFree = lo;
+  while (firstFree < STATS_SLOTS_PER_SECTOR && !slotErased(slotAt(base + firstFree)))
+    firstFree++;
+  nextSlot = (base + firstFree) % STATS_LOG_SLOTS;
+}
+
+void statsStoreSave(const GameStats *stats)
+{
+  pendingStats = *stats;
+  pending = true;
+}
+
+/**
+ * @brief Erases a sector or programs a page with the XIP off.
+ * Core 1 waits in SRAM meanwhile, since it cannot fetch code from flash.
+ */
+static void runFlashOperation(uint32_t offset, const uint8_t *page)
+{
+#if PATROSUM_DUAL_CORE
+  multicore_lockout_start_blocking();
+#endif
+  uint32_t irq = save_and_disable_interrupts();
+  if (page)
+    flash_range_program(offset, page, FLASH_PAGE_SIZE);
+  else
+    flash_range_erase(offset, FLASH_SECTOR_SIZE);
+  restore_interrupts(irq);
+#if PATROSUM_DUAL_CORE
+  multicore_lockout_end_blocking();
+#endif
+}
+
+/**
+ * @brief Does the next flash operation of the pending save.
+ * @return true once the record is written
+ */
+static bool writeStep(void)
+{
+  bool sectorStart = nextSlot % STATS_SLOTS_PER_SECTOR == 0;
+  if (sectorStart && !upcomingReady)
+  {
+    // Nenhuma pausa desde o começo do setor anterior: apaga agora, grava na próxima chamada
+    statsStorePrepare();
+    return false;
+  }
+
+  StatsRecord record;
+  memset(&record, 0xFF, sizeof(record));
+  record.magic = STATS_RECORD_MAGIC;
+  record.sequence = nextSequence;
+  record.stats = pendingStats;
+  record.check = recordCheck(&record);
+
+  uint32_t offset = STATS_LOG_OFFSET + nextSlot * sizeof(StatsRecord);
+  uint32_t pageOffset = offset & ~(uint32_t)(FLASH_PAGE_SIZE - 1);
+  memset(pageBuffer, 0xFF, sizeof(pageBuffer));
+  memcpy(&pageBuffer[offset - pageOffset], &record, sizeof(record));
+  runFlashOperation(pageOffset, pageBuffer);
+
+  nextSlot = (nextSlot + 1) % STATS_LOG_SLOTS;
+  nextSequence++;
+  if (sectorStart)
+    upcomingReady = false; // Primeiro registro do setor: o seguinte passa a ser o próximo a apagar
+  pending = false;
+  nextSaveAt = make_timeout_time_ms(STATS_SAVE_INTERVAL_MS);
+  return true;
+}
+
+bool statsStorePoll(void)
+{
+  if (!pending || !time_reached(nextSaveAt))
+    return false;
+  writeStep();
+  return true;
+}
+
+void statsStorePrepare(void)
+{
+  if (upcomingReady)
+    return;
+
+  uint32_t sector = upcomingSector();
+  if (!sectorErased(sector)) // Ainda guarda registros antigos da volta anterior
+    runFlashOperation(STATS_LOG_OFFSET + sector * FLASH_SECTOR_SIZE, NULL);
+  upcomingReady = true;
+}
+
+void statsStoreFlush(void)
+{
+  while (pending && !writeStep())
+    ;
+  statsStorePrepare(); // Antes de dormir: quem joga depois não espera apagar
+}
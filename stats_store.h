@@ -0,0 +1,78 @@
+/**
+ * @file stats_store.h
+ * @brief Player statistics kept across resets in a wear-levelled flash log.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The last STATS_LOG_SECTORS sectors of the flash hold an append-only log
+ * of fixed-size records, each one a full copy of the statistics. A save
+ * appends the next record, and the sector after the one being written is
+ * erased ahead of time, while nobody plays, so erases rotate over the
+ * whole region and are never done in the middle of a game.
+ * At boot, one record per sector and a binary search inside the newest
+ * sector find the latest record, so startup does not grow with the log.
+ *
+ * Saves only update a RAM copy. statsStorePoll() writes it at most every
+ * STATS_SAVE_INTERVAL_MS as a single page program, with interrupts off and
+ * core 1 locked out. The sector erases happen in statsStorePrepare().
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef STATS_STORE_H
+#define STATS_STORE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Setores de 4 KiB no fim da flash reservados ao log (128 registros cada). */
+#ifndef STATS_LOG_SECTORS
+#define STATS_LOG_SECTORS 4
+#endif
+
+/** Intervalo mínimo entre gravações: várias respostas viram uma escrita. */
+#ifndef STATS_SAVE_INTERVAL_MS
+#define STATS_SAVE_INTERVAL_MS 60000
+#endif
+
+typedef struct
+{
+  uint32_t answered;   // Respostas desde a primeira gravação
+  uint32_t correct;    // Acertos
+  uint16_t streak;     // Acertos seguidos em andamento
+  uint16_t bestStreak; // Recorde de acertos seguidos
+} GameStats;
+
+/**
+ * @brief Finds the latest record in the log and returns its statistics.
+ * Zeroed statistics when the log is empty or unreadable.
+ */
+void statsStoreLoad(GameStats *out);
+
+/**
+ * @brief Keeps a copy of the statistics to write later. Never touches the flash.
+ */
+void statsStoreSave(const GameStats *stats);
+
+/**
+ * @brief Writes the pending copy if the save interval has passed.
+ * One page program; a sector erase only if statsStorePrepare() has not run
+ * since the write position entered its current sector (128 saves earlier).
+ * Call it only when a short stall is harmless (no sound, no typing).
+ * @return true if the flash was touched
+ */
+bool statsStorePoll(void);
+
+/**
+ * @brief Erases the sector the log will write into next, if it still holds
+ * old records. Stalls for one sector erase: call it at boot, after
+ * statsStoreLoad(), and while nobody plays (attract screen).
+ */
+void statsStorePrepare(void);
+
+/**
+ * @brief Writes the pending copy right away, then prepares the next sector.
+ */
+void statsStoreFlush(void);
+
+#endif // STATS_STORE_H
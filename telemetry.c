@@ -0,0 +1,221 @@
+/**
+ * @file telemetry.c
+ * @brief Answer ring and the background UDP uploader.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Records are written and sent from the game loop on core 0, so the ring
+ * needs no lock. lwIP itself runs in the CYW43 background interrupt; the
+ * calls into it here are wrapped in cyw43_arch_lwip_begin()/end() and none
+ * of them waits for the network: udp_sendto() only queues the datagram.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "telemetry.h"
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "pico/unique_id.h"
+#include "pico/cyw43_arch.h"
+#include "lwip/pbuf.h"
+#include "lwip/udp.h"
+#include "lwip/ip_addr.h"
+
+#ifndef TELEMETRY_WIFI_SSID
+#define TELEMETRY_WIFI_SSID ""
+#endif
+
+#ifndef TELEMETRY_WIFI_PASSWORD
+#define TELEMETRY_WIFI_PASSWORD ""
+#endif
+
+#ifndef TELEMETRY_HOST
+#define TELEMETRY_HOST "192.168.0.10"
+#endif
+
+#define TELEMETRY_RING_MASK (TELEMETRY_RING_RECORDS - 1)
+
+typedef enum
+{
+  RADIO_OFF,        // Sem rádio (falha no init, sem SSID ou dormindo)
+  RADIO_CONNECTING, // Associação/DHCP em andamento, feitos em segundo plano
+  RADIO_UP          // Com IP: pode enviar
+} RadioState;
+
+// Anel de registros: head e tail só crescem, o índice é o valor mascarado
+static AnswerRecord ring[TELEMETRY_RING_RECORDS];
+static uint32_t head = 0; // Próximo registro a escrever
+static uint32_t tail = 0; // Próximo registro a enviar
+static uint32_t dropped = 0;
+static uint32_t sequence = 0;
+
+static RadioState radio = RADIO_OFF;
+static bool radioReady = false; // cyw43_arch_init() funcionou
+static struct udp_pcb *pcb = NULL;
+static ip_addr_t collector;
+static pico_unique_board_id_t boardId;
+static absolute_time_t flushAt;   // Envia um lote incompleto a partir daqui
+static absolute_time_t retryAt;   // Próxima tentativa de conexão depois de uma falha
+
+/**
+ * @brief Starts connecting without waiting; the link status is polled later.
+ */
+static void startConnect(void)
+{
+  if (!radioReady || TELEMETRY_WIFI_SSID[0] == '\0')
+  {
+    radio = RADIO_OFF;
+    return;
+  }
+
+  const char *password = TELEMETRY_WIFI_PASSWORD;
+  uint32_t auth = password[0] ? CYW43_AUTH_WPA2_AES_PSK : CYW43_AUTH_OPEN;
+  if (cyw43_arch_wifi_connect_async(TELEMETRY_WIFI_SSID, password[0] ? password : NULL, auth) == 0)
+    radio = RADIO_CONNECTING;
+  else
+    radio = RADIO_OFF;
+  retryAt = make_timeout_time_ms(TELEMETRY_RETRY_MS);
+}
+
+void telemetryInit(void)
+{
+  pico_get_unique_board_id(&boardId);
+  flushAt = make_timeout_time_ms(TELEMETRY_FLUSH_MS);
+
+  if (cyw43_arch_init() != 0)
+    return; // Sem rádio o jogo segue igual; os registros ficam no anel
+
+  cyw43_arch_enable_sta_mode();
+  radioReady = true;
+
+  cyw43_arch_lwip_begin();
+  pcb = udp_new();
+  cyw43_arch_lwip_end();
+  if (!pcb || !ipaddr_aton(TELEMETRY_HOST, &collector))
+  {
+    radioReady = false;
+    return;
+  }
+
+  startConnect();
+}
+
+void telemetryRecordAnswer(char op, uint16_t a, uint16_t b, uint16_t correct, uint16_t given, uint32_t responseMs)
+{
+  if (head - tail == TELEMETRY_RING_RECORDS)
+  {
+    tail++; // Anel cheio: perde o mais antigo
+    dropped++;
+  }
+
+  AnswerRecord *r = &ring[head & TELEMETRY_RING_MASK];
+  r->sequence = sequence++;
+  r->a = a;
+  r->b = b;
+  r->correct = correct;
+  r->given = given;
+  r->responseMs = (uint16_t)(responseMs < UINT16_MAX ? responseMs : UINT16_MAX);
+  r->flags = given == correct ? TELEMETRY_FLAG_CORRECT : 0;
+  r->op = op;
+  head++;
+}
+
+/**
+ * @brief Queues one datagram with up to TELEMETRY_BATCH_RECORDS records.
+ * The records leave the ring only if lwIP accepted the datagram.
+ */
+static void sendBatch(void)
+{
+  uint32_t count = head - tail;
+  if (count > TELEMETRY_BATCH_RECORDS)
+    count = TELEMETRY_BATCH_RECORDS;
+
+  uint16_t length = (uint16_t)(sizeof(TelemetryBatchHeader) + count * sizeof(AnswerRecord));
+
+  cyw43_arch_lwip_begin();
+  struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, length, PBUF_RAM);
+  if (p)
+  {
+    uint8_t *out = (uint8_t *)p->payload;
+
+    TelemetryBatchHeader header = {
+        .magic = {'P', 'S'},
+        .version = TELEMETRY_FORMAT_VERSION,
+        .count = (uint8_t)count,
+        .dropped = dropped,
+    };
+    memcpy(header.boardId, boardId.id, sizeof(header.boardId));
+    memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+
+    // O lote pode dar a volta no anel: copia em até dois pedaços
+    uint32_t first = tail & TELEMETRY_RING_MASK;
+    uint32_t run = TELEMETRY_RING_RECORDS - first;
+    if (run > count)
+      run = count;
+    memcpy(out, &ring[first], run * sizeof(AnswerRecord));
+    memcpy(out + run * sizeof(AnswerRecord), &ring[0], (count - run) * sizeof(AnswerRecord));
+
+    if (udp_sendto(pcb, p, &collector, TELEMETRY_PORT) == ERR_OK)
+      tail += count;
+    pbuf_free(p);
+  }
+  cyw43_arch_lwip_end();
+}
+
+void telemetryPoll(void)
+{
+  if (!radioReady)
+    return;
+
+  switch (radio)
+  {
+  case RADIO_OFF:
+    if (time_reached(retryAt))
+      startConnect();
+    break;
+  case RADIO_CONNECTING:
+  {
+    // Só lê o estado que o driver atualiza em segundo plano
+    int status = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
+    if (status == CYW43_LINK_UP)
+      radio = RADIO_UP;
+    else if (status < 0 || time_reached(retryAt)) // Falha, senha errada ou rede sumiu
+      radio = RADIO_OFF;
+  }
+  break;
+  case RADIO_UP:
+    if (cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA) != CYW43_LINK_UP)
+    {
+      startConnect(); // Caiu: reconecta em segundo plano
+      break;
+    }
+
+    // Lotes cheios saem logo; um lote parcial espera TELEMETRY_FLUSH_MS
+    uint32_t pending = head - tail;
+    if (pending >= TELEMETRY_BATCH_RECORDS || (pending > 0 && time_reached(flushAt)))
+    {
+      sendBatch();
+      flushAt = make_timeout_time_ms(TELEMETRY_FLUSH_MS);
+    }
+    break;
+  }
+}
+
+void telemetrySuspend(void)
+{
+  if (!radioReady)
+    return;
+  cyw43_arch_disable_sta_mode(); // Desliga a associação e o rádio entra em repouso
+  radio = RADIO_OFF;
+}
+
+void telemetryResume(void)
+{
+  if (!radioReady)
+    return;
+  cyw43_arch_enable_sta_mode();
+  startConnect();
+}
@@ -0,0 +1,105 @@
+/**
+ * @file telemetry.h
+ * @brief Per-answer records kept in a RAM ring and uploaded in UDP batches over Wi-Fi.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * The game appends one fixed-size record per answer; telemetryPoll(),
+ * called once per loop iteration, sends them to a collector in batches of
+ * TELEMETRY_BATCH_RECORDS (or whatever is pending after TELEMETRY_FLUSH_MS)
+ * once the Pico W is on the network. The radio runs lwIP in the background
+ * (pico_cyw43_arch_lwip_threadsafe_background): connecting and sending never
+ * wait, and without Wi-Fi the records just stay in the ring, overwriting the
+ * oldest when it fills up.
+ *
+ * Datagram format (little-endian): a TelemetryBatchHeader followed by
+ * `count` AnswerRecord. tools/telemetry_collector.py decodes it to CSV.
+ *
+ * Built only with -DPATROSUM_TELEMETRY=ON.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef TELEMETRY_RING_RECORDS
+#define TELEMETRY_RING_RECORDS 256 // 4 KiB de RAM (potência de 2)
+#endif
+
+/** Registros por datagrama (16 + 32 * 16 = 528 bytes, abaixo do MTU). */
+#ifndef TELEMETRY_BATCH_RECORDS
+#define TELEMETRY_BATCH_RECORDS 32
+#endif
+
+/** Envia um lote incompleto depois desse tempo sem enviar. */
+#ifndef TELEMETRY_FLUSH_MS
+#define TELEMETRY_FLUSH_MS 30000
+#endif
+
+/** Espera antes de tentar conectar de novo depois de uma falha. */
+#ifndef TELEMETRY_RETRY_MS
+#define TELEMETRY_RETRY_MS 15000
+#endif
+
+#ifndef TELEMETRY_PORT
+#define TELEMETRY_PORT 5005
+#endif
+
+#define TELEMETRY_FORMAT_VERSION 2
+#define TELEMETRY_FLAG_CORRECT 0x01
+
+typedef struct __attribute__((packed))
+{
+  uint32_t sequence;   // Número da resposta desde o boot
+  uint16_t a;          // Primeira parcela
+  uint16_t b;          // Segunda parcela
+  uint16_t correct;    // Resposta certa
+  uint16_t given;      // Resposta do jogador
+  uint16_t responseMs; // Da pergunta na tela ao 'A' (satura em 65535)
+  uint8_t flags;       // TELEMETRY_FLAG_*
+  char op;             // Operação: '+', '-' ou 'x'
+} AnswerRecord;
+
+typedef struct __attribute__((packed))
+{
+  char magic[2];      // "PS"
+  uint8_t version;    // TELEMETRY_FORMAT_VERSION
+  uint8_t count;      // Registros que seguem
+  uint8_t boardId[8]; // ID único da flash: identifica a unidade
+  uint32_t dropped;   // Registros sobrescritos no anel desde o boot
+} TelemetryBatchHeader;
+
+/**
+ * @brief Brings the radio up and starts connecting in the background.
+ * Blocks while the CYW43 firmware loads, so main.c calls it once the first
+ * question is on the panel rather than in setup(). Answers recorded before
+ * it wait in the ring.
+ */
+void telemetryInit(void);
+
+/**
+ * @brief Appends the record of one answer to the ring. Never blocks.
+ */
+void telemetryRecordAnswer(char op, uint16_t a, uint16_t b, uint16_t correct, uint16_t given, uint32_t responseMs);
+
+/**
+ * @brief Sends a batch if one is due and retries the connection after failures.
+ * Cheap when there is nothing to do; call it once per loop iteration.
+ */
+void telemetryPoll(void);
+
+/**
+ * @brief Switches the radio off while the game sleeps; the ring is kept.
+ */
+void telemetrySuspend(void);
+
+/**
+ * @brief Switches the radio back on and reconnects in the background.
+ */
+void telemetryResume(void);
+
+#endif // TELEMETRY_H
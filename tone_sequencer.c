@@ -0,0 +1,213 @@
+/**
+ * @file tone_sequencer.c
+ * @brief Alarm-driven tone sequencer on top of the buzzer PWM slice.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "tone_sequencer.h"
+#include "latency_trace.h"
+
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+
+#if PATROSUM_AUDIO_PCM
+#include "audio.h"
+#endif
+
+// Fila circular de notas: o loop principal escreve em head, o alarme consome em tail.
+static ToneNote toneQueue[TONE_QUEUE_SIZE];
+static volatile uint8_t toneHead = 0;
+static volatile uint8_t toneTail = 0;
+
+static volatile bool tonePlaying = false;
+static volatile bool backgroundTones = false; // A fila atual cede ao próximo som
+static alarm_id_t toneAlarm = 0;
+static uint16_t pendingGapMs = 0; // Gap da nota atual, aplicado quando ela termina
+static uint sliceNum;
+
+#if PATROSUM_AUDIO_PCM
+/**
+ * @brief Holds the note on the music voice of the PCM engine.
+ * A frequency of 0 fades it out.
+ */
+static void setBuzzerFrequency(uint16_t frequency)
+{
+  audioTone(AUDIO_VOICE_MUSIC, frequency, 0, AUDIO_DEFAULT_VOLUME);
+}
+#else
+/**
+ * @brief Programs the PWM slice for a square wave at the given frequency.
+ * A frequency of 0 silences the buzzer.
+ */
+static void setBuzzerFrequency(uint16_t frequency)
+{
+  if (frequency == 0)
+  {
+    pwm_set_gpio_level(BUZZER_PIN, 0);
+    return;
+  }
+
+  // Escolhe o menor divisor inteiro que mantém o TOP dentro de 16 bits
+  uint32_t clock = clock_get_hz(clk_sys);
+  uint32_t divider = clock / ((uint32_t)frequency * 65536u) + 1;
+  if (divider > 255)
+    divider = 255;
+  uint32_t top = clock / (divider * frequency) - 1;
+
+  pwm_set_clkdiv_int_frac(sliceNum, (uint8_t)divider, 0);
+  pwm_set_wrap(sliceNum, (uint16_t)top);
+  pwm_set_gpio_level(BUZZER_PIN, (uint16_t)(top / 2)); // 50% duty cycle
+  pwm_set_enabled(sliceNum, true);
+}
+#endif
+
+/**
+ * @brief Starts the next queued note.
+ * @return Microseconds until the alarm must fire again, or 0 if the queue is empty.
+ */
+static int64_t startNextNote(void)
+{
+  if (toneTail == toneHead)
+  {
+    setBuzzerFrequency(0);
+    tonePlaying = false;
+    backgroundTones = false;
+    return 0;
+  }
+
+  ToneNote note = toneQueue[toneTail];
+  toneTail = (toneTail + 1) % TONE_QUEUE_SIZE;
+
+  setBuzzerFrequency(note.frequency);
+  pendingGapMs = note.gap_ms;
+  tonePlaying = true;
+
+  // Duração zero ainda precisa de um disparo futuro para seguir a fila
+  return note.duration_ms > 0 ? (int64_t)note.duration_ms * 1000 : 1;
+}
+
+static int64_t toneAlarmCallback(alarm_id_t id, void *user_data)
+{
+  (void)id;
+  (void)user_data;
+
+  // Fim da nota: se houver gap, silencia e espera antes da próxima
+  if (pendingGapMs > 0)
+  {
+    int64_t gap_us = (int64_t)pendingGapMs * 1000;
+    pendingGapMs = 0;
+    setBuzzerFrequency(0);
+    return gap_us;
+  }
+
+  int64_t next_us = startNextNote();
+  if (next_us == 0)
+    toneAlarm = 0;
+  return next_us; // > 0 reagenda relativo ao disparo anterior
+}
+
+void initToneSequencer(void)
+{
+#if PATROSUM_AUDIO_PCM
+  initAudio(); // Assume o slice do buzzer configurado por initBuzzerPWM()
+#endif
+  sliceNum = pwm_gpio_to_slice_num(BUZZER_PIN);
+  toneHead = toneTail = 0;
+  tonePlaying = false;
+  setBuzzerFrequency(0);
+}
+
+/**
+ * @brief Drops the rest of a background sequence before a new sound.
+ */
+static void yieldBackgroundTones(void)
+{
+  if (backgroundTones)
+    stopTones();
+}
+
+bool queueTones(const ToneNote *notes, size_t count)
+{
+  yieldBackgroundTones();
+  bool queuedAll = true;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    uint8_t next = (toneHead + 1) % TONE_QUEUE_SIZE;
+    if (next == toneTail)
+    {
+      queuedAll = false; // Fila cheia, descarta o restante
+      break;
+    }
+    toneQueue[toneHead] = notes[i];
+    toneHead = next;
+  }
+
+  // Se o sequenciador estiver parado, inicia a primeira nota imediatamente
+  uint32_t irq = save_and_disable_interrupts();
+  if (!tonePlaying)
+  {
+    int64_t next_us = startNextNote();
+    if (next_us > 0)
+      toneAlarm = add_alarm_in_us(next_us, toneAlarmCallback, NULL, true);
+  }
+  restore_interrupts(irq);
+
+  return queuedAll;
+}
+
+void playTones(const ToneNote *notes, size_t count)
+{
+  stopTones();
+  queueTones(notes, count);
+}
+
+void playBackgroundTones(const ToneNote *notes, size_t count)
+{
+  playTones(notes, count);
+  backgroundTones = tonePlaying;
+}
+
+void queueTone(uint16_t frequency, uint16_t duration_ms)
+{
+  ToneNote note = {frequency, duration_ms, 0};
+  queueTones(&note, 1);
+}
+
+void playEffect(uint16_t frequency, uint16_t duration_ms)
+{
+  LATENCY_MARK(LATENCY_FEEDBACK);
+  yieldBackgroundTones(); // Também com a voz própria: o som do jogo não disputa com o jingle
+#if PATROSUM_AUDIO_PCM
+  audioTone(AUDIO_VOICE_EFFECT, frequency, duration_ms, AUDIO_DEFAULT_VOLUME); // Sem alarme: o mixer conta a duração
+#else
+  queueTone(frequency, duration_ms);
+#endif
+}
+
+void stopTones(void)
+{
+  uint32_t irq = save_and_disable_interrupts();
+  if (toneAlarm > 0)
+    cancel_alarm(toneAlarm);
+  toneAlarm = 0;
+  toneHead = toneTail = 0;
+  pendingGapMs = 0;
+  tonePlaying = false;
+  backgroundTones = false;
+  setBuzzerFrequency(0);
+#if PATROSUM_AUDIO_PCM
+  audioRelease(AUDIO_VOICE_EFFECT);
+#endif
+  restore_interrupts(irq);
+}
+
+bool isTonePlaying(void)
+{
+  return tonePlaying;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file tone_sequencer.h
+ * @brief Non-blocking tone sequencer for the BitDogLab buzzer.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Notes are queued as (frequency, duration, gap) and played in the background
+ * by a hardware alarm driving the buzzer PWM slice configured by initBuzzerPWM().
+ * The game loop never waits for a tone to finish.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef TONE_SEQUENCER_H
+#define TONE_SEQUENCER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "buzzer.h"
+
+/** Quantidade máxima de notas pendentes na fila. */
+#define TONE_QUEUE_SIZE 16
+
+/**
+ * @brief A single note of a sequence.
+ * A frequency of 0 is a rest (silence for duration_ms).
+ */
+typedef struct
+{
+  uint16_t frequency;   // Hz (0 = pausa)
+  uint16_t duration_ms; // Duração da nota
+  uint16_t gap_ms;      // Silêncio após a nota
+} ToneNote;
+
+/**
+ * @brief Prepares the sequencer. Must be called after initBuzzerPWM().
+ */
+void initToneSequencer(void);
+
+/**
+ * @brief Appends notes to the queue and starts playback if idle.
+ * @param notes Notes to play, in order
+ * @param count Number of notes
+ * @return true if every note was queued, false if the queue filled up
+ */
+bool queueTones(const ToneNote *notes, size_t count);
+
+/**
+ * @brief Replaces whatever is playing with a new sequence.
+ */
+void playTones(const ToneNote *notes, size_t count);
+
+/**
+ * @brief Replaces whatever is playing with a sequence that yields to the
+ * next sound: the first queueTones(), queueTone() or playEffect() call
+ * drops what is left of it instead of waiting behind it (welcome jingle).
+ */
+void playBackgroundTones(const ToneNote *notes, size_t count);
+
+/**
+ * @brief Queues a single beep (convenience for keypad feedback).
+ */
+void queueTone(uint16_t frequency, uint16_t duration_ms);
+
+/**
+ * @brief Plays a short feedback sound (key clicks) right away.
+ * With the PCM engine it has its own voice, mixed over any melody playing;
+ * with the square-wave buzzer it is queued like queueTone().
+ */
+void playEffect(uint16_t frequency, uint16_t duration_ms);
+
+/**
+ * @brief Silences the buzzer and drops all pending notes.
+ */
+void stopTones(void);
+
+/**
+ * @brief Returns true while a note or gap is still in progress.
+ */
+bool isTonePlaying(void);
+
+#endif // TONE_SEQUENCER_H
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""Flash/RAM size report and budget check for the PatroSum firmware.
+
+Reads the GNU ld map file written by pico_add_extra_outputs() and the symbol
+table of the ELF (through nm) and prints:
+
+  - flash and RAM per library (game, patroLibs, each pico-sdk component,
+    newlib, libgcc, ...);
+  - the RAM map: static data (.data/.bss), heap and the stacks of both cores;
+  - the largest symbols.
+
+Exits with status 1 when the flash image or the static RAM exceed the
+budgets, so a size regression stops the build.
+
+  size_report.py --elf PatroSum.elf --map PatroSum.elf.map --nm arm-none-eabi-nm
+                 [--flash-budget BYTES] [--ram-budget BYTES] [--top N]
+                 [--summary] [--output FILE]
+"""
+
+import argparse
+import collections
+import os
+import re
+import subprocess
+import sys
+
+# Seções de saída do memmap do SDK que ocupam flash e/ou RAM
+FLASH_SECTIONS = {".boot2", ".text", ".rodata", ".ARM.extab", ".ARM.exidx", ".binary_info", ".data",
+                  ".scratch_x", ".scratch_y", ".init_array", ".fini_array"}
+RAM_SECTIONS = {".ram_vector_table", ".data", ".uninitialized_data", ".scratch_x", ".scratch_y", ".bss",
+                ".tbss", ".tdata"}
+# Faixa da SRAM do RP2040: com copy_to_ram, .text também é ligada aqui
+RAM_START = 0x20000000
+RAM_END = 0x20042000
+
+OUTPUT_SECTION_RE = re.compile(r"^(\.\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+OUTPUT_SECTION_NAME_RE = re.compile(r"^(\.\S+)\s*$")
+INPUT_SECTION_RE = re.compile(r"^ (\.\S+|COMMON)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+INPUT_SECTION_NAME_RE = re.compile(r"^ (\.\S+|COMMON)\s*$")
+ARCHIVE_RE = re.compile(r"([^/\\]+)\.a\(([^)]+)\)$")
+
+
+def classify(path):
+    """Groups an input file of the map into a library name."""
+    archive = ARCHIVE_RE.search(path)
+    if archive:
+        lib = archive.group(1)
+        if lib.startswith("libc"):
+            return "newlib (%s)" % lib
+        if lib.startswith("libm"):
+            return "newlib (libm)"
+        return lib
+
+    norm = path.replace("\\", "/")
+    if "bitdoglibs" in norm or "patrolibs" in norm.lower():
+        return "patroLibs"
+    for marker in ("/lib/tinyusb/", "/lib/cyw43-driver/", "/lib/lwip/", "/lib/btstack/", "/lib/mbedtls/"):
+        if marker in norm:
+            return "pico-sdk " + marker.split("/")[2]
+    match = re.search(r"/src/(?:rp2_common|common|rp2040|host)/([^/]+)/", norm)
+    if match:
+        return "pico-sdk " + match.group(1)
+    if "pico-sdk" in norm or "/pico-sdk/" in norm:
+        return "pico-sdk (outros)"
+    if os.path.basename(norm).startswith("crt") or "libgcc" in norm:
+        return "toolchain"
+    return "PatroSum"
+
+
+def is_ram(name, address):
+    """An output section occupies RAM if it is a data section or is linked at a SRAM address."""
+    return name in RAM_SECTIONS or (name in FLASH_SECTIONS and RAM_START <= address < RAM_END)
+
+
+def parse_map(path):
+    """Returns ({output section: size}, {library: [flash, ram]}, set of sections in RAM)."""
+    sections = {}
+    in_ram = set()
+    libraries = collections.defaultdict(lambda: [0, 0])
+
+    current = None
+    pending_input = False
+    pending_output = None
+    in_memory_map = False
+
+    with open(path, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            line = line.rstrip("\n")
+
+            if not in_memory_map:
+                # Antes disso vêm as seções descartadas e a configuração de memória
+                in_memory_map = line.startswith("Linker script and memory map")
+                continue
+
+            # Nome de seção de saída longo: endereço e tamanho na linha seguinte
+            if pending_output:
+                match = re.match(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)", line)
+                if match:
+                    current = pending_output
+                    sections[current] = sections.get(current, 0) + int(match.group(2), 16)
+                    if is_ram(current, int(match.group(1), 16)):
+                        in_ram.add(current)
+                pending_output = None
+                continue
+
+            match = OUTPUT_SECTION_RE.match(line)
+            if match:
+                current = match.group(1)
+                sections[current] = sections.get(current, 0) + int(match.group(3), 16)
+                if is_ram(current, int(match.group(2), 16)):
+                    in_ram.add(current)
+                continue
+            match = OUTPUT_SECTION_NAME_RE.match(line)
+            if match:
+                pending_output = match.group(1)
+                continue
+            if line and not line.startswith(" "):
+                current = None  # /DISCARD/, OUTPUT(...), etc.
+                continue
+            if current is None:
+                continue
+
+            if INPUT_SECTION_NAME_RE.match(line):
+                pending_input = True
+                continue
+
+            match = INPUT_SECTION_RE.match(line)
+            if not match or (match.group(1) is None and not pending_input):
+                pending_input = False
+                continue
+            pending_input = False
+
+            size = int(match.group(3), 16)
+            origin = match.group(4).strip()
+            if size == 0 or origin.startswith("*fill*"):
+                continue
+
+            lib = libraries[classify(origin)]
+            if current in FLASH_SECTIONS:
+                lib[0] += size
+            if current in in_ram:
+                lib[1] += size
+
+    return sections, libraries, in_ram
+
+
+def read_symbols(nm, elf):
+    """Returns (list of (size, type, name), {name: address}) from nm."""
+    try:
+        out = subprocess.run([nm, "-S", "--size-sort", elf], check=True, capture_output=True, text=True).stdout
+        addr_out = subprocess.run([nm, elf], check=True, capture_output=True, text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as exc:
+        print("size_report: nm falhou: %s" % exc, file=sys.stderr)
+        return [], {}
+
+    sized = []
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) >= 4:
+            sized.append((int(parts[1], 16), parts[2], parts[3]))
+    sized.sort(reverse=True)
+
+    addresses = {}
+    for line in addr_out.splitlines():
+        parts = line.split()
+        if len(parts) >= 3:
+            addresses[parts[2]] = int(parts[0], 16)
+    return sized, addresses
+
+
+def span(addresses, start, end):
+    if start in addresses and end in addresses:
+        return addresses[end] - addresses[start]
+    return None
+
+
+def kib(size):
+    return "n/d" if size is None else "%8d (%6.1f KiB)" % (size, size / 1024.0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--elf", required=True)
+    parser.add_argument("--map", required=True)
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--flash-budget", type=int, default=0, help="bytes, 0 = sem limite")
+    parser.add_argument("--ram-budget", type=int, default=0, help="bytes de RAM estática, 0 = sem limite")
+    parser.add_argument("--top", type=int, default=25, help="quantos símbolos listar")
+    parser.add_argument("--summary", action="store_true", help="só os totais e os orçamentos")
+    parser.add_argument("--output", help="também grava o relatório neste arquivo")
+    args = parser.parse_args()
+
+    sections, libraries, in_ram = parse_map(args.map)
+    symbols, addresses = read_symbols(args.nm, args.elf)
+
+    flash = span(addresses, "__flash_binary_start", "__flash_binary_end")
+    if flash is None:
+        flash = sum(size for name, size in sections.items() if name in FLASH_SECTIONS)
+    static_ram = sum(size for name, size in sections.items() if name in in_ram)
+    heap = span(addresses, "__end__", "__HeapLimit")
+    stack0 = span(addresses, "__StackBottom", "__StackTop")
+    stack1 = span(addresses, "__StackOneBottom", "__StackOneTop")
+
+    lines = []
+    lines.append("== %s" % os.path.basename(args.elf))
+    lines.append("flash (imagem)        %s" % kib(flash))
+    lines.append("RAM estática          %s   .data/.bss/scratch%s"
+                 % (kib(static_ram), " + .text (copy_to_ram)" if ".text" in in_ram else ""))
+    lines.append("heap                  %s   __end__ .. __HeapLimit" % kib(heap))
+    lines.append("pilha core 0          %s" % kib(stack0))
+    lines.append("pilha core 1          %s" % kib(stack1))
+
+    if not args.summary:
+        lines.append("")
+        lines.append("-- seções")
+        for name, size in sorted(sections.items(), key=lambda item: -item[1]):
+            if size:
+                lines.append("  %-24s %8d" % (name, size))
+
+        lines.append("")
+        lines.append("-- por biblioteca          flash      RAM")
+        for name, (lib_flash, lib_ram) in sorted(libraries.items(), key=lambda item: -item[1][0]):
+            lines.append("  %-24s %8d %8d" % (name, lib_flash, lib_ram))
+
+        lines.append("")
+        lines.append("-- maiores símbolos (%d)" % args.top)
+        for size, kind, name in symbols[:args.top]:
+            lines.append("  %8d %s %s" % (size, kind, name))
+
+    failures = []
+    if args.flash_budget and flash > args.flash_budget:
+        failures.append("flash %d > orçamento %d (+%d bytes)" % (flash, args.flash_budget, flash - args.flash_budget))
+    if args.ram_budget and static_ram > args.ram_budget:
+        failures.append("RAM estática %d > orçamento %d (+%d bytes)"
+                        % (static_ram, args.ram_budget, static_ram - args.ram_budget))
+
+    lines.append("")
+    if args.flash_budget:
+        lines.append("orçamento de flash    %8d, livre %d" % (args.flash_budget, args.flash_budget - flash))
+    if args.ram_budget:
+        lines.append("orçamento de RAM      %8d, livre %d" % (args.ram_budget, args.ram_budget - static_ram))
+    for failure in failures:
+        lines.append("ESTOURO: " + failure)
+
+    report = "\n".join(lines) + "\n"
+    sys.stdout.write(report)
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as f:
+            f.write(report)
+
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Receives the PatroSum telemetry datagrams and appends them to a CSV file.
+
+Each datagram (telemetry.h) is a 16-byte header followed by 16-byte answer
+records, all little-endian. One CSV line is written per record, tagged with
+the board that sent it, so one collector can serve a whole classroom. An
+existing file with other columns (an older collector) is left untouched and
+the records go to a new, timestamped file next to it.
+
+  telemetry_collector.py [--port 5005] [--output respostas.csv]
+"""
+
+import argparse
+import csv
+import os
+import socket
+import struct
+import sys
+import time
+
+HEADER = struct.Struct("<2sBB8sI")
+RECORD = struct.Struct("<IHHHHHBB")
+# Versão 1 não tinha a operação (só somas): o byte era 0
+FORMAT_VERSIONS = (1, 2)
+FLAG_CORRECT = 0x01
+
+COLUMNS = ["received_at", "board", "sequence", "op", "a", "b", "correct", "given", "response_ms", "is_correct"]
+
+
+def decode(datagram):
+    """Returns (board, dropped, records) or None when the datagram is not ours."""
+    if len(datagram) < HEADER.size:
+        return None
+    magic, version, count, board, dropped = HEADER.unpack_from(datagram)
+    if magic != b"PS" or version not in FORMAT_VERSIONS or len(datagram) != HEADER.size + count * RECORD.size:
+        return None
+    records = [RECORD.unpack_from(datagram, HEADER.size + i * RECORD.size) for i in range(count)]
+    return board.hex(), dropped, records
+
+
+def output_path(path):
+    """Returns the file to append to: path itself, unless it has other columns."""
+    if not os.path.exists(path) or os.path.getsize(path) == 0:
+        return path
+    with open(path, newline="", encoding="utf-8") as f:
+        header = next(csv.reader(f), None)
+    if header == COLUMNS:
+        return path
+    stem, ext = os.path.splitext(path)
+    fresh = "%s-%s%s" % (stem, time.strftime("%Y%m%d-%H%M%S"), ext or ".csv")
+    sys.stderr.write("%s tem outras colunas; gravando em %s\n" % (path, fresh))
+    return fresh
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", type=int, default=5005)
+    parser.add_argument("--output", default="respostas.csv")
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("", args.port))
+
+    path = output_path(args.output)
+    new_file = not os.path.exists(path) or os.path.getsize(path) == 0
+    with open(path, "a", newline="", encoding="utf-8") as f:
+        writer = csv.writer(f)
+        if new_file:
+            writer.writerow(COLUMNS)
+
+        # Último registro por placa: lacunas na sequência são lotes perdidos na rede
+        last_sequence = {}
+        while True:
+            datagram, (host, _) = sock.recvfrom(2048)
+            decoded = decode(datagram)
+            if decoded is None:
+                sys.stderr.write("datagrama ignorado de %s (%d bytes)\n" % (host, len(datagram)))
+                continue
+
+            board, dropped, records = decoded
+            now = time.strftime("%Y-%m-%dT%H:%M:%S")
+            for sequence, a, b, correct, given, response_ms, flags, op in records:
+                writer.writerow([now, board, sequence, chr(op) if op else "+", a, b, correct, given, response_ms,
+                                 int(bool(flags & FLAG_CORRECT))])
+            f.flush()
+
+            first = records[0][0] if records else None
+            expected = last_sequence.get(board)
+            if first is not None and expected is not None and first > expected:
+                sys.stderr.write("%s: %d registros faltando antes de %d\n" % (board, first - expected, first))
+            if records:
+                last_sequence[board] = records[-1][0] + 1
+            print("%s %s: %d registros (%d perdidos no anel desde o boot)" % (now, board, len(records), dropped))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
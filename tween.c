@@ -0,0 +1,116 @@
+/**
+ * @file tween.c
+ * @brief Easing lookup tables and tween updates.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Each curve is sampled at EASE_TABLE_STEPS + 1 points in Q8.8 and
+ * interpolated linearly between them, which is indistinguishable from the
+ * exact curve at the panel's resolution.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#include "tween.h"
+
+#define EASE_TABLE_STEPS 32
+#define EASE_STEP_PHASE (TWEEN_PHASE_ONE / EASE_TABLE_STEPS)
+
+// round(f(i / 32) * 256), i = 0..32; EASE_LINEAR não precisa de tabela
+static const int16_t easeTables[EASE_COUNT - 1][EASE_TABLE_STEPS + 1] = {
+    // EASE_IN_QUAD: t²
+    {0, 0, 1, 2, 4, 6, 9, 12, 16, 20, 25,
+     30, 36, 42, 49, 56, 64, 72, 81, 90, 100, 110,
+     121, 132, 144, 156, 169, 182, 196, 210, 225, 240, 256},
+    // EASE_OUT_QUAD: 1 - (1 - t)²
+    {0, 16, 31, 46, 60, 74, 87, 100, 112, 124, 135,
+     146, 156, 166, 175, 184, 192, 200, 207, 214, 220, 226,
+     231, 236, 240, 244, 247, 250, 252, 254, 255, 256, 256},
+    // EASE_IN_OUT_QUAD: 2t² até a metade, espelhado depois
+    {0, 0, 2, 4, 8, 12, 18, 24, 32, 40, 50,
+     60, 72, 84, 98, 112, 128, 144, 158, 172, 184, 196,
+     206, 216, 224, 232, 238, 244, 248, 252, 254, 256, 256},
+    // EASE_OUT_CUBIC: 1 - (1 - t)³
+    {0, 23, 45, 65, 84, 102, 119, 134, 148, 161, 173,
+     184, 194, 202, 210, 218, 224, 230, 235, 239, 242, 246,
+     248, 250, 252, 253, 254, 255, 256, 256, 256, 256, 256},
+    // EASE_OUT_BACK: 1 + 2.70158 (t - 1)³ + 1.70158 (t - 1)²
+    {0, 36, 69, 99, 126, 151, 173, 192, 209, 224, 237,
+     248, 257, 265, 271, 275, 278, 280, 281, 282, 281, 279,
+     277, 275, 272, 270, 267, 264, 261, 259, 258, 256, 256},
+};
+
+int32_t easeApply(Easing easing, uint32_t phase)
+{
+  if (phase >= TWEEN_PHASE_ONE)
+    return TWEEN_ONE;
+  if (easing == EASE_LINEAR || easing >= EASE_COUNT)
+    return (int32_t)(phase * TWEEN_ONE / TWEEN_PHASE_ONE);
+
+  // Interpola entre as duas amostras vizinhas
+  const int16_t *table = easeTables[easing - 1];
+  uint32_t i = phase / EASE_STEP_PHASE;
+  int32_t frac = (int32_t)(phase % EASE_STEP_PHASE);
+  return table[i] + (table[i + 1] - table[i]) * frac / EASE_STEP_PHASE;
+}
+
+void tweenSet(Tween *tween, int32_t value)
+{
+  tween->from = value;
+  tween->to = value;
+  tween->value = value;
+  tween->elapsedUs = 0;
+  tween->durationUs = 0;
+  tween->easing = EASE_LINEAR;
+}
+
+void tweenStart(Tween *tween, int32_t from, int32_t to, uint16_t durationMs, Easing easing)
+{
+  if (durationMs > TWEEN_MAX_DURATION_MS)
+    durationMs = TWEEN_MAX_DURATION_MS;
+
+  tween->from = from;
+  tween->to = to;
+  tween->value = durationMs ? from : to;
+  tween->elapsedUs = 0;
+  tween->durationUs = (uint32_t)durationMs * 1000u;
+  tween->easing = easing;
+}
+
+void tweenTo(Tween *tween, int32_t to, uint16_t durationMs, Easing easing)
+{
+  if (tween->to == to)
+    return; // Já está indo para lá (ou chegou)
+  tweenStart(tween, tween->value, to, durationMs, easing);
+}
+
+int32_t tweenUpdate(Tween *tween, uint32_t dtUs)
+{
+  if (tweenDone(tween))
+    return tween->value;
+
+  tween->elapsedUs += dtUs;
+  if (tween->elapsedUs >= tween->durationUs)
+  {
+    tween->elapsedUs = tween->durationUs;
+    tween->value = tween->to;
+    return tween->value;
+  }
+
+  // elapsedUs < durationUs <= 4 s: o produto cabe em 32 bits (divisor de hardware)
+  uint32_t phase = tween->elapsedUs * TWEEN_PHASE_ONE / tween->durationUs;
+  int32_t eased = easeApply(tween->easing, phase);
+  tween->value = tween->from + (tween->to - tween->from) * eased / TWEEN_ONE;
+  return tween->value;
+}
+
+bool tweenDone(const Tween *tween)
+{
+  return tween->elapsedUs >= tween->durationUs;
+}
+
+int tweenInt(const Tween *tween)
+{
+  // Deslocamento aritmético: arredonda também valores negativos
+  return (tween->value + TWEEN_ONE / 2) >> 8;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file tween.h
+ * @brief Fixed-point tweens with precomputed easing curves.
+ * @author Luis Felipe Patrocinio (https://github.com/luisfpatrocinio/)
+ *
+ * Values are Q8.8 (TWEEN_ONE = 1.0) and time is advanced with the delta of
+ * the frame scheduler, so an animation lasts the same whatever the frame
+ * rate. Everything is integer math: the RP2040 has no FPU, and a soft-float
+ * call per frame for a one-pixel step costs more than the step itself.
+ *
+ * @copyright Copyright (c) 2025 Luis Felipe Patrocinio
+ * @license This project is released under the MIT License.
+ */
+
+#ifndef TWEEN_H
+#define TWEEN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** 1.0 em Q8.8. */
+#define TWEEN_ONE 256
+#define TWEEN_FROM_INT(x) ((int32_t)(x) * TWEEN_ONE)
+
+/** Fim do progresso passado a easeApply() (Q10). */
+#define TWEEN_PHASE_ONE 1024
+
+/** Duração máxima: mantém elapsedUs * TWEEN_PHASE_ONE em 32 bits. */
+#define TWEEN_MAX_DURATION_MS 4000
+
+typedef enum
+{
+  EASE_LINEAR,
+  EASE_IN_QUAD,
+  EASE_OUT_QUAD,
+  EASE_IN_OUT_QUAD,
+  EASE_OUT_CUBIC,
+  EASE_OUT_BACK, // Passa um pouco do alvo (~10%) e volta
+  EASE_COUNT
+} Easing;
+
+typedef struct
+{
+  int32_t from;  // Q8.8
+  int32_t to;    // Q8.8
+  int32_t value; // Q8.8, atualizado por tweenUpdate()
+  uint32_t elapsedUs;
+  uint32_t durationUs;
+  Easing easing;
+} Tween;
+
+/**
+ * @brief Evaluates an easing curve.
+ * @param phase Progress from 0 to TWEEN_PHASE_ONE
+ * @return Eased progress in Q8.8 (0 to TWEEN_ONE, slightly more for EASE_OUT_BACK)
+ */
+int32_t easeApply(Easing easing, uint32_t phase);
+
+/**
+ * @brief Jumps straight to a value, with no animation running.
+ * @param value Q8.8
+ */
+void tweenSet(Tween *tween, int32_t value);
+
+/**
+ * @brief Starts an animation between two values.
+ * @param from Start value (Q8.8)
+ * @param to End value (Q8.8); |to - from| must stay below TWEEN_FROM_INT(25000)
+ * @param durationMs Clamped to TWEEN_MAX_DURATION_MS; 0 jumps to the end
+ */
+void tweenStart(Tween *tween, int32_t from, int32_t to, uint16_t durationMs, Easing easing);
+
+/**
+ * @brief Animates from the current value to a new target.
+ * Does nothing if the tween already heads to that target, so it can be
+ * called every frame with the desired value.
+ */
+void tweenTo(Tween *tween, int32_t to, uint16_t durationMs, Easing easing);
+
+/**
+ * @brief Advances the animation.
+ * @param dtUs Time since the last update (frame scheduler delta)
+ * @return Current value (Q8.8)
+ */
+int32_t tweenUpdate(Tween *tween, uint32_t dtUs);
+
+/**
+ * @brief Whether the animation reached its target.
+ */
+bool tweenDone(const Tween *tween);
+
+/**
+ * @brief Current value rounded to the nearest integer (e.g. pixels).
+ */
+int tweenInt(const Tween *tween);
+
+#endif // TWEEN_H